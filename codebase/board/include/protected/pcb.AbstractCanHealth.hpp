@@ -0,0 +1,226 @@
+/**
+ * @file      pcb.AbstractCanHealth.hpp
+ * @brief     EOOS abstract CAN controller health monitor
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_ABSTRACTCANHEALTH_HPP_
+#define PCB_ABSTRACTCANHEALTH_HPP_
+
+#include "lib.NonCopyable.hpp"
+#include "lib.NoAllocator.hpp"
+#include "pcb.Handler.hpp"
+#include "pcb.EventGroup.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @class AbstractCanHealth
+ * @brief Health monitor of a CAN controller with recovery from bus-off.
+ *
+ * Counters of the controller are updated from its status change interrupt and from
+ * the periodic handler, which is called by a pcb::Timer with the period of the policy.
+ * The handler also recovers the controller from bus-off after a delay, which is doubled
+ * on each recovery up to the maximum, and which is reset to the initial one after
+ * the controller has been on the bus for the stable time. Changes of the state
+ * set the event bits to an event group.
+ */
+class AbstractCanHealth : public lib::NonCopyable<lib::NoAllocator>, public Handler
+{
+
+public:
+
+    /**
+     * @enum State
+     * @brief Fault confinement states.
+     */
+    enum State
+    {
+        STATE_ERROR_ACTIVE  = 0, ///< Both error counters are less than 96.
+        STATE_ERROR_WARNING = 1, ///< An error counter reached the warning limit of 96.
+        STATE_ERROR_PASSIVE = 2, ///< An error counter is greater than 127.
+        STATE_BUS_OFF       = 3  ///< The transmit error counter is greater than 255.
+    };
+
+    /**
+     * @enum Recovery
+     * @brief Recovery modes from bus-off.
+     */
+    enum Recovery
+    {
+        RECOVERY_MANUAL    = 0, ///< The controller is recovered by recover() call.
+        RECOVERY_AUTOMATIC = 1  ///< The controller is recovered by the periodic handler with back-off.
+    };
+
+    /**
+     * @struct Policy
+     * @brief Recovery policy.
+     *
+     * The initial delay must exceed the time of 128 occurrences of 11 recessive bits,
+     * which the controller waits for to leave bus-off.
+     */
+    struct Policy
+    {
+        Recovery recovery;    ///< Recovery mode.
+        int32_t period;       ///< Period of the handler in milliseconds.
+        int32_t initialDelay; ///< Initial delay of recovery in milliseconds.
+        int32_t maximumDelay; ///< Maximum delay of recovery in milliseconds.
+        int32_t stableTime;   ///< Time on the bus to reset the delay in milliseconds.
+    };
+
+    /**
+     * @struct Status
+     * @brief Health status of the controller.
+     */
+    struct Status
+    {
+        State state;               ///< Current state.
+        uint32_t tec;              ///< Transmit error counter.
+        uint32_t rec;              ///< Receive error counter.
+        uint32_t warnings;         ///< Number of entries to the error warning state.
+        uint32_t errorPassives;    ///< Number of entries to the error passive state.
+        uint32_t busOffs;          ///< Number of entries to the bus-off state.
+        uint32_t recoveries;       ///< Number of exits from the bus-off state.
+        uint32_t errors;           ///< Number of protocol errors observed.
+        uint32_t lostArbitrations; ///< Number of lost arbitrations observed.
+        uint32_t overruns;         ///< Number of receive FIFO overruns.
+        int32_t delay;             ///< Current delay of recovery in milliseconds.
+    };
+
+    static const uint32_t EVENT_ERROR_ACTIVE  = 0x00000001U; ///< The controller became error active.
+    static const uint32_t EVENT_ERROR_WARNING = 0x00000002U; ///< The controller reached the warning limit.
+    static const uint32_t EVENT_ERROR_PASSIVE = 0x00000004U; ///< The controller became error passive.
+    static const uint32_t EVENT_BUS_OFF       = 0x00000008U; ///< The controller went bus-off.
+    static const uint32_t EVENT_RECOVERED     = 0x00000010U; ///< The controller left bus-off.
+    static const uint32_t EVENT_OVERRUN       = 0x00000020U; ///< A receive FIFO overrun occurred.
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~AbstractCanHealth();
+
+    /**
+     * @brief Returns the health status.
+     *
+     * The status is copied with the interrupts masked, so it is consistent.
+     *
+     * @param status Status.
+     * @return true if the status has been copied.
+     */
+    bool_t getStatus(Status* status) const;
+
+    /**
+     * @brief Updates the counters from the controller.
+     */
+    void update();
+
+    /**
+     * @brief Updates the counters from the controller in an interrupt service routine.
+     */
+    void updateFromInterrupt();
+
+    /**
+     * @brief Recovers the controller from bus-off.
+     *
+     * @return true if the controller is in bus-off and recovery is started.
+     */
+    bool_t recover();
+
+    /**
+     * @brief Updates the counters and recovers the controller from bus-off by the policy.
+     *
+     * The function is called periodically with the period of the policy.
+     */
+    virtual void handle();
+
+protected:
+
+    /**
+     * @struct Sample
+     * @brief Error status read from the controller.
+     */
+    struct Sample
+    {
+        uint32_t tec;              ///< Transmit error counter.
+        uint32_t rec;              ///< Receive error counter.
+        bool_t isWarning;          ///< Error warning flag.
+        bool_t isPassive;          ///< Error passive flag.
+        bool_t isBusOff;           ///< Bus-off flag.
+        uint32_t errors;           ///< Number of protocol errors since the previous sample.
+        uint32_t lostArbitrations; ///< Number of lost arbitrations since the previous sample.
+        uint32_t overruns;         ///< Number of receive FIFO overruns since the previous sample.
+    };
+
+    /**
+     * @brief Constructor.
+     *
+     * @param policy Recovery policy.
+     * @param events Event group to be notified, or NULLPTR.
+     */
+    AbstractCanHealth(Policy const& policy, EventGroup* events);
+
+    /**
+     * @brief Reads the error status of the controller.
+     *
+     * The function is called from an interrupt service routine too, so it must not block.
+     *
+     * @param sample Error status.
+     */
+    virtual void sample(Sample* sample) = 0;
+
+    /**
+     * @brief Requests the controller to leave bus-off.
+     */
+    virtual void restart() = 0;
+
+private:
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @param policy Recovery policy.
+     * @return true if object has been constructed successfully.
+     */
+    bool_t construct(Policy const& policy);
+
+    /**
+     * @brief Updates the counters from the controller.
+     *
+     * @param isInterrupt The function is called from an interrupt service routine.
+     */
+    void update(bool_t isInterrupt);
+
+    /**
+     * @brief Recovery policy.
+     */
+    Policy policy_;
+
+    /**
+     * @brief Event group to be notified.
+     */
+    EventGroup* events_;
+
+    /**
+     * @brief Health status.
+     */
+    Status status_;
+
+    /**
+     * @brief Time in bus-off since the state is entered or the last restart in milliseconds.
+     */
+    int32_t offTime_;
+
+    /**
+     * @brief Time on the bus since the last bus-off in milliseconds.
+     */
+    int32_t onTime_;
+
+};
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_ABSTRACTCANHEALTH_HPP_
@@ -0,0 +1,200 @@
+/**
+ * @file      pcb.Benchmark.hpp
+ * @brief     EOOS microbenchmark
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_BENCHMARK_HPP_
+#define PCB_BENCHMARK_HPP_
+
+#include "lib.NonCopyable.hpp"
+#include "lib.NoAllocator.hpp"
+#include "api.OutStream.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @class Benchmark
+ * @brief Microbenchmark of a code fragment in counter ticks.
+ *
+ * A task is run a number of times to warm up caches and branch predictors,
+ * then each run is measured by a counter, which is the CPU cycle counter by default,
+ * and the overhead of reading the counter is subtracted. Samples are kept in
+ * a buffer of the caller, so no heap memory is used and the object is small enough
+ * to be on a thread stack, and they are summarized by the minimum, the median,
+ * the 99th percentile, the maximum, the mean and the standard deviation.
+ *
+ * A result is written as one line of the format, which ide/eoos-exe-tests-keil/benchmark.py parses,
+ * and which is a TAP comment not to break the test output:
+ *
+ * # BENCH name=<name> n=<samples> min=<min> median=<median> p99=<p99> max=<max> mean=<mean> stddev=<stddev> unit=cycles
+ */
+class Benchmark : public lib::NonCopyable<lib::NoAllocator>
+{
+
+public:
+
+    /**
+     * @class Task
+     * @brief Code fragment to be measured.
+     */
+    class Task
+    {
+
+    public:
+
+        /**
+         * @brief Destructor.
+         */
+        virtual ~Task() = 0;
+
+        /**
+         * @brief Runs the code fragment once.
+         */
+        virtual void run() = 0;
+
+    };
+
+    /**
+     * @brief Counter of time.
+     *
+     * @return Current value of the counter, which wraps at 32 bits.
+     */
+    typedef uint32_t (*Counter)();
+
+    /**
+     * @enum Mode
+     * @brief Modes of measuring.
+     */
+    enum Mode
+    {
+        MODE_ITERATIONS = 0, ///< The task is measured a number of times.
+        MODE_TIME       = 1  ///< The task is measured until a time elapses or samples are full.
+    };
+
+    /**
+     * @struct Config
+     * @brief Benchmark configuration.
+     */
+    struct Config
+    {
+        char_t const* name; ///< Name of the benchmark without spaces.
+        Mode mode;          ///< Mode of measuring.
+        int32_t warmup;     ///< Number of runs before measuring.
+        int32_t iterations; ///< Number of measured runs up to MAXIMUM_SAMPLES.
+        uint32_t time;      ///< Time of measuring in counter ticks for MODE_TIME.
+        Counter counter;    ///< Counter of time, or NULLPTR for the CPU cycle counter.
+        uint32_t* samples;  ///< Buffer of iterations samples, which must exist while the object exists.
+    };
+
+    /**
+     * @struct Result
+     * @brief Summary of samples in counter ticks.
+     */
+    struct Result
+    {
+        int32_t samples; ///< Number of samples.
+        uint32_t min;    ///< Minimum.
+        uint32_t median; ///< Median.
+        uint32_t p99;    ///< 99th percentile.
+        uint32_t max;    ///< Maximum.
+        uint32_t mean;   ///< Mean.
+        uint32_t stddev; ///< Standard deviation.
+    };
+
+    /**
+     * @brief Maximum number of samples, which bounds the time of sorting them.
+     */
+    static const int32_t MAXIMUM_SAMPLES = 256;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param config Benchmark configuration.
+     */
+    explicit Benchmark(Config const& config);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~Benchmark();
+
+    /**
+     * @brief Measures a task.
+     *
+     * @param task Task to be measured.
+     * @return true if the task has been measured.
+     */
+    bool_t run(Task& task);
+
+    /**
+     * @brief Returns the result of the last measuring.
+     *
+     * @return The result.
+     */
+    Result const& getResult() const;
+
+    /**
+     * @brief Writes the result line to a stream.
+     *
+     * @param stream Stream to write to.
+     */
+    void print(api::OutStream<char_t>& stream) const;
+
+private:
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @param config Benchmark configuration.
+     * @return true if object has been constructed successfully.
+     */
+    bool_t construct(Config const& config);
+
+    /**
+     * @brief Measures the overhead of reading the counter.
+     *
+     * @return Minimal number of ticks between two readings.
+     */
+    uint32_t calibrate() const;
+
+    /**
+     * @brief Summarizes the samples.
+     *
+     * @param number Number of samples.
+     */
+    void summarize(int32_t number);
+
+    /**
+     * @brief Reads the CPU cycle counter.
+     *
+     * @return The counter.
+     */
+    static uint32_t getCycles();
+
+    /**
+     * @brief Benchmark configuration.
+     */
+    Config config_;
+
+    /**
+     * @brief Result of the last measuring.
+     */
+    Result result_;
+
+    /**
+     * @brief Samples of the last measuring.
+     */
+    uint32_t* samples_;
+
+};
+
+inline Benchmark::Task::~Task() {}
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_BENCHMARK_HPP_
@@ -11,6 +11,9 @@
 #include "lib.NoAllocator.hpp"
 #include "lib.UniquePointer.hpp"
 #include "drv.Usart.hpp"
+#include "pcb.Clock.hpp"
+#include "pcb.ClockScaler.hpp"
+#include "pcb.UsartRetiming.hpp"
 
 namespace eoos
 {
@@ -70,6 +73,21 @@ private:
      */    
     lib::UniquePointer<drv::Usart,lib::SmartPointerDeleter<drv::Usart>,lib::NoAllocator> usart_;
 
+    /**
+     * @brief Monotonic clock of the system.
+     */
+    Clock clock_;
+
+    /**
+     * @brief Clock profiles of the system.
+     */
+    ClockScaler scaler_;
+
+    /**
+     * @brief Baud rate keeper of the serial debug port.
+     */
+    UsartRetiming usartRetiming_;
+
 };
 
 } // namespace pcb
@@ -0,0 +1,96 @@
+/**
+ * @file      pcb.CanHealth.hpp
+ * @brief     EOOS CAN1 controller health monitor
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_CANHEALTH_HPP_
+#define PCB_CANHEALTH_HPP_
+
+#include "pcb.AbstractCanHealth.hpp"
+#include "pcb.Ramfunc.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @class CanHealth
+ * @brief Health monitor of CAN1 controller.
+ *
+ * The status change interrupt of CAN1 updates the counters on the error warning,
+ * the error passive and the bus-off changes. The automatic bus-off management of
+ * the controller is disabled, so that the controller is recovered by the policy only,
+ * and it is restored on the destructor call.
+ * Protocol errors and lost arbitrations are observed by the last error code and
+ * the arbitration lost flags at updates, so the counts are lower bounds.
+ *
+ * @note CAN1 must be initialized by the CAN driver before the object is constructed.
+ *       CAN1 status change interrupt is owned by the object, therefore only one object can exist.
+ */
+class CanHealth : public AbstractCanHealth
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param policy Recovery policy.
+     * @param events Event group to be notified, or NULLPTR.
+     */
+    CanHealth(Policy const& policy, EventGroup* events);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~CanHealth();
+
+protected:
+
+    /**
+     * @copydoc eoos::pcb::AbstractCanHealth::sample(Sample*)
+     */
+    virtual void sample(Sample* sample);
+
+    /**
+     * @copydoc eoos::pcb::AbstractCanHealth::restart()
+     */
+    virtual void restart();
+
+private:
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return true if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Handles CAN1 status change interrupt.
+     */
+    EOOS_PCB_RAMFUNC static void handleInterrupt();
+
+    /**
+     * @brief The object owning CAN1 status change interrupt.
+     */
+    static CanHealth* health_;
+
+    /**
+     * @brief Arbitration lost flags of the previous sample.
+     */
+    uint32_t arbitrations_;
+
+    /**
+     * @brief Automatic bus-off management was enabled before the constructor call.
+     */
+    bool_t isAbom_;
+
+};
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_CANHEALTH_HPP_
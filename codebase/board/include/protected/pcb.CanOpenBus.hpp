@@ -0,0 +1,49 @@
+/**
+ * @file      pcb.CanOpenBus.hpp
+ * @brief     EOOS CANopen bus interface
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_CANOPENBUS_HPP_
+#define PCB_CANOPENBUS_HPP_
+
+#include "drv.Can.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @class CanOpenBus
+ * @brief Bus which CANopen frames are sent to.
+ *
+ * The interface is implemented by a CAN driver adapter, or by a simulated bus.
+ * The function is called from CAN interrupt context, so it must not block on the kernel.
+ */
+class CanOpenBus
+{
+
+public:
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~CanOpenBus() = 0;
+
+    /**
+     * @brief Puts a frame to the transmit mailboxes.
+     *
+     * @param message Frame to be sent.
+     * @return true if the frame is put.
+     */
+    virtual bool_t transmit(drv::Can::Message const& message) = 0;
+
+};
+
+inline CanOpenBus::~CanOpenBus() {}
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_CANOPENBUS_HPP_
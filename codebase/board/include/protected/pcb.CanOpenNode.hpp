@@ -0,0 +1,174 @@
+/**
+ * @file      pcb.CanOpenNode.hpp
+ * @brief     EOOS CANopen node of process data objects
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_CANOPENNODE_HPP_
+#define PCB_CANOPENNODE_HPP_
+
+#include "lib.NonCopyable.hpp"
+#include "lib.NoAllocator.hpp"
+#include "pcb.CanOpenBus.hpp"
+#include "pcb.CanOpenPdo.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @class CanOpenNode
+ * @brief CANopen-lite node of synchronous TPDOs and RPDOs.
+ *
+ * Received frames are given to the node from the CAN receive interrupt. A SYNC frame
+ * sends TPDOs which transmission types expire, and a frame of an RPDO is taken by the PDO.
+ * The receive filters pass SYNC and RPDO frames only, so that other frames do not
+ * interrupt the CPU. PDOs are added before the frames are given to the node.
+ *
+ * @note NMT, SDO and EMCY services are not supported.
+ */
+class CanOpenNode : public lib::NonCopyable<lib::NoAllocator>
+{
+
+public:
+
+    /**
+     * @brief COB-ID of SYNC.
+     */
+    static const uint32_t COB_ID_SYNC = 0x080U;
+
+    /**
+     * @brief Maximum number of TPDOs.
+     */
+    static const int32_t MAXIMUM_TPDOS = 4;
+
+    /**
+     * @brief Maximum number of RPDOs.
+     */
+    static const int32_t MAXIMUM_RPDOS = 4;
+
+    /**
+     * @brief Maximum synchronous transmission type, which is the number of SYNCs between TPDOs.
+     */
+    static const uint32_t MAXIMUM_TRANSMISSION_TYPE = 240U;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param bus Bus to send TPDOs.
+     */
+    CanOpenNode(CanOpenBus& bus);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~CanOpenNode();
+
+    /**
+     * @brief Adds a synchronous TPDO.
+     *
+     * @param pdo              PDO to be sent.
+     * @param transmissionType Number of SYNCs between sending the PDO, from 1 to 240.
+     * @return true if the PDO has been added.
+     */
+    bool_t addTpdo(CanOpenPdo& pdo, uint32_t transmissionType);
+
+    /**
+     * @brief Adds an RPDO.
+     *
+     * @param pdo PDO to be received.
+     * @return true if the PDO has been added.
+     */
+    bool_t addRpdo(CanOpenPdo& pdo);
+
+    /**
+     * @brief Sets the receive filters of SYNC and RPDOs.
+     *
+     * Filter banks in identifier list mode are set from the index given, two identifiers per bank.
+     *
+     * @param can   CAN driver.
+     * @param fifo  FIFO the frames are put to.
+     * @param index Index of the first filter bank.
+     * @return Number of filter banks set, or zero if an error has been occurred.
+     */
+    int32_t setReceiveFilters(drv::Can& can, drv::Can::RxFilter::Fifo fifo, int32_t index);
+
+    /**
+     * @brief Handles a received frame.
+     *
+     * The function is called from the CAN receive interrupt.
+     *
+     * @param message Received frame.
+     * @return true if the frame is SYNC or a frame of an RPDO.
+     */
+    bool_t handleMessage(drv::Can::Message const& message);
+
+    /**
+     * @brief Returns number of SYNCs received.
+     *
+     * @return The number.
+     */
+    uint32_t getSyncCount() const;
+
+private:
+
+    /**
+     * @struct Tpdo
+     * @brief Synchronous TPDO.
+     */
+    struct Tpdo
+    {
+        CanOpenPdo* pdo;           ///< PDO.
+        uint32_t transmissionType; ///< Number of SYNCs between sending.
+        uint32_t syncs;            ///< Number of SYNCs left to sending.
+    };
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return true if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Sends TPDOs which transmission types expire.
+     */
+    void handleSync();
+
+    /**
+     * @brief Bus to send TPDOs.
+     */
+    CanOpenBus& bus_;
+
+    /**
+     * @brief TPDOs.
+     */
+    Tpdo tpdos_[MAXIMUM_TPDOS];
+
+    /**
+     * @brief RPDOs.
+     */
+    CanOpenPdo* rpdos_[MAXIMUM_RPDOS];
+
+    /**
+     * @brief Number of TPDOs.
+     */
+    int32_t tpdosNumber_;
+
+    /**
+     * @brief Number of RPDOs.
+     */
+    int32_t rpdosNumber_;
+
+    /**
+     * @brief Number of SYNCs received.
+     */
+    uint32_t volatile syncCount_;
+
+};
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_CANOPENNODE_HPP_
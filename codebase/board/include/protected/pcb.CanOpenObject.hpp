@@ -0,0 +1,188 @@
+/**
+ * @file      pcb.CanOpenObject.hpp
+ * @brief     EOOS CANopen object dictionary entries mapped to PDOs
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_CANOPENOBJECT_HPP_
+#define PCB_CANOPENOBJECT_HPP_
+
+#include "pcb.CanOpenPdo.hpp"
+#include "pcb.CriticalSection.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @class CanOpenObject<OD_INDEX,OD_SUBINDEX,T,OFFSET>
+ * @brief Object of the dictionary mapped to a PDO at compile time.
+ *
+ * The object is stored in the data of the PDO frame in little-endian byte order,
+ * as CANopen requires, at the byte offset given. The object is read and written
+ * in a critical section, so that a thread does not get or leave a torn value
+ * when the CAN interrupt receives or sends the frame in the middle of copying.
+ * Several objects of one PDO are consistent to each other if they are accessed
+ * in one pcb::CriticalSection of the caller.
+ *
+ * @tparam OD_INDEX    Index of the object in the dictionary.
+ * @tparam OD_SUBINDEX Sub-index of the object in the dictionary.
+ * @tparam T           Integer type of the object.
+ * @tparam OFFSET      Byte offset of the object in the PDO data.
+ */
+template <uint32_t OD_INDEX, uint32_t OD_SUBINDEX, typename T, uint32_t OFFSET>
+class CanOpenObject
+{
+
+public:
+
+    /**
+     * @brief Size of the object in bytes.
+     */
+    static const uint32_t SIZE = sizeof(T);
+
+    /**
+     * @brief Byte offset of the object in the PDO data.
+     */
+    static const uint32_t BEGIN = OFFSET;
+
+    /**
+     * @brief Byte offset next to the object in the PDO data.
+     */
+    static const uint32_t END = OFFSET + sizeof(T);
+
+    /**
+     * @brief Returns the mapping parameter of the object.
+     *
+     * @return The index, the sub-index and the length in bits, as sub-indexes of 0x1600 and 0x1A00 objects.
+     */
+    static uint32_t getMapping()
+    {
+        return (OD_INDEX << 16U) | (OD_SUBINDEX << 8U) | (SIZE * 8U);
+    }
+
+    /**
+     * @brief Reads the object.
+     *
+     * @param pdo PDO the object is mapped to.
+     * @return Value of the object.
+     */
+    static T read(CanOpenPdo const& pdo)
+    {
+        uint8_t const* const data( &pdo.getMessage().data.v8[OFFSET] );
+        uint64_t value( 0U );
+        CriticalSection const section;
+        for(uint32_t i(0U); i<SIZE; i++)
+        {
+            value |= static_cast<uint64_t>(data[i]) << (i * 8U);
+        }
+        return static_cast<T>(value);
+    }
+
+    /**
+     * @brief Writes the object.
+     *
+     * @param pdo   PDO the object is mapped to.
+     * @param value Value of the object.
+     */
+    static void write(CanOpenPdo& pdo, T const value)
+    {
+        uint8_t* const data( &pdo.getMessage().data.v8[OFFSET] );
+        uint64_t const bits( static_cast<uint64_t>(value) );
+        CriticalSection const section;
+        for(uint32_t i(0U); i<SIZE; i++)
+        {
+            data[i] = static_cast<uint8_t>( bits >> (i * 8U) );
+        }
+    }
+
+private:
+
+    /**
+     * @brief Compile-time check of the object to be in the PDO data.
+     */
+    typedef char SizeCheck[ ((SIZE >= 1U) && (SIZE <= 8U) && (END <= 8U)) ? 1 : -1 ];
+
+    /**
+     * @brief Compile-time check of the index and the sub-index range.
+     */
+    typedef char IndexCheck[ ((OD_INDEX >= 0x2000U) && (OD_INDEX <= 0xFFFFU) && (OD_SUBINDEX <= 0xFFU)) ? 1 : -1 ];
+
+};
+
+/**
+ * @class CanOpenObjectNone
+ * @brief Absence of an object in a PDO mapping.
+ */
+class CanOpenObjectNone
+{
+
+public:
+
+    /**
+     * @brief Size of the object in bytes.
+     */
+    static const uint32_t SIZE = 0U;
+
+    /**
+     * @brief Byte offset of the object in the PDO data.
+     */
+    static const uint32_t BEGIN = 0U;
+
+    /**
+     * @brief Byte offset next to the object in the PDO data.
+     */
+    static const uint32_t END = 0U;
+
+};
+
+/**
+ * @class CanOpenMapping<O1,O2,O3,O4>
+ * @brief Mapping of objects to a PDO checked at compile time.
+ *
+ * The objects must follow each other from the first byte of the PDO data
+ * without gaps and overlaps, and absent objects must be the last ones.
+ *
+ * @tparam O1 First object.
+ * @tparam O2 Second object.
+ * @tparam O3 Third object.
+ * @tparam O4 Fourth object.
+ */
+template <class O1, class O2 = CanOpenObjectNone, class O3 = CanOpenObjectNone, class O4 = CanOpenObjectNone>
+class CanOpenMapping
+{
+
+public:
+
+    /**
+     * @brief Number of mapped objects.
+     */
+    static const int32_t NUMBER = (O2::SIZE == 0U) ? 1 : (O3::SIZE == 0U) ? 2 : (O4::SIZE == 0U) ? 3 : 4;
+
+    /**
+     * @brief Data length of the PDO.
+     */
+    static const int32_t DLC = static_cast<int32_t>( O1::SIZE + O2::SIZE + O3::SIZE + O4::SIZE );
+
+private:
+
+    /**
+     * @brief Compile-time check of the objects layout.
+     */
+    typedef char LayoutCheck[ ( (O1::SIZE != 0U) && (O1::BEGIN == 0U)
+                             && ( (O2::SIZE == 0U) ? (O3::SIZE == 0U) : (O2::BEGIN == O1::END) )
+                             && ( (O3::SIZE == 0U) ? (O4::SIZE == 0U) : (O3::BEGIN == O2::END) )
+                             && ( (O4::SIZE == 0U) || (O4::BEGIN == O3::END) ) ) ? 1 : -1 ];
+
+    /**
+     * @brief Compile-time check of the data length.
+     */
+    typedef char LengthCheck[ (DLC <= 8) ? 1 : -1 ];
+
+};
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_CANOPENOBJECT_HPP_
@@ -0,0 +1,119 @@
+/**
+ * @file      pcb.CanOpenPdo.hpp
+ * @brief     EOOS CANopen process data object
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_CANOPENPDO_HPP_
+#define PCB_CANOPENPDO_HPP_
+
+#include "lib.NonCopyable.hpp"
+#include "lib.NoAllocator.hpp"
+#include "drv.Can.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @class CanOpenPdo
+ * @brief Process data object, which frame is the storage of its mapped objects.
+ *
+ * Objects of the dictionary mapped to the PDO are read and written in the data of
+ * the frame by CanOpenObject, so a TPDO is sent and an RPDO is received without
+ * packing the objects to an intermediate buffer.
+ *
+ * The data of the frame is shared by threads and the CAN interrupt, and it is
+ * copied in a critical section on receiving and sending, so that the frame is
+ * never taken in the middle of writing an object by CanOpenObject. A caller of
+ * getMessage() that accesses the data directly must do it in pcb::CriticalSection.
+ */
+class CanOpenPdo : public lib::NonCopyable<lib::NoAllocator>
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param cobId COB-ID of the PDO, which is an 11-bit identifier.
+     * @param dlc   Data length of the PDO, which is CanOpenMapping::DLC of its objects.
+     */
+    CanOpenPdo(uint32_t cobId, int32_t dlc);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~CanOpenPdo();
+
+    /**
+     * @brief Returns COB-ID of the PDO.
+     *
+     * @return The COB-ID.
+     */
+    uint32_t getCobId() const;
+
+    /**
+     * @brief Returns the frame of the PDO.
+     *
+     * @return The frame.
+     */
+    drv::Can::Message& getMessage();
+
+    /**
+     * @brief Returns the frame of the PDO.
+     *
+     * @return The frame.
+     */
+    drv::Can::Message const& getMessage() const;
+
+    /**
+     * @brief Takes data of a received frame.
+     *
+     * The data is copied in a critical section.
+     *
+     * @param message Frame of the COB-ID of the PDO.
+     * @return true if the data length of the frame is of the PDO.
+     */
+    bool_t receive(drv::Can::Message const& message);
+
+    /**
+     * @brief Returns number of frames sent or received.
+     *
+     * The number is to be compared with a previous one to detect new data.
+     *
+     * @return The number.
+     */
+    uint32_t getCount() const;
+
+    /**
+     * @brief Counts a sent frame.
+     */
+    void count();
+
+private:
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return true if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Frame of the PDO.
+     */
+    drv::Can::Message message_;
+
+    /**
+     * @brief Number of frames sent or received.
+     */
+    uint32_t volatile count_;
+
+};
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_CANOPENPDO_HPP_
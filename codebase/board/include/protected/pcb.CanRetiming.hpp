@@ -0,0 +1,97 @@
+/**
+ * @file      pcb.CanRetiming.hpp
+ * @brief     EOOS CAN bit timing retiming on clock changes
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_CANRETIMING_HPP_
+#define PCB_CANRETIMING_HPP_
+
+#include "pcb.ClockListener.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @class CanRetiming
+ * @brief Listener which keeps the bit rate and the sample point of CAN on clock changes.
+ *
+ * The time quantum frequency is kept by recalculating the prescaler only, so that
+ * the segments of a bit are kept, and a change is rejected if the next APB1 clock
+ * is not a multiple of the time quantum frequency. The controller is put to initialization mode during the change after
+ * pending transmissions are sent, and it is back on the bus after 11 recessive bits.
+ */
+class CanRetiming : public ClockListener
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    CanRetiming();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~CanRetiming();
+
+    /**
+     * @copydoc eoos::pcb::ClockListener::suspend(ClockFrequencies const&, ClockFrequencies const&)
+     */
+    virtual bool_t suspend(ClockFrequencies const& current, ClockFrequencies const& next);
+
+    /**
+     * @copydoc eoos::pcb::ClockListener::resume(ClockFrequencies const&)
+     */
+    virtual void resume(ClockFrequencies const& frequencies);
+
+private:
+
+    /**
+     * @struct Registers
+     * @brief bxCAN control and status registers.
+     */
+    struct Registers
+    {
+        uint32_t volatile mcr;  ///< Master control register.
+        uint32_t volatile msr;  ///< Master status register.
+        uint32_t volatile tsr;  ///< Transmit status register.
+        uint32_t volatile rf0r; ///< Receive FIFO 0 register.
+        uint32_t volatile rf1r; ///< Receive FIFO 1 register.
+        uint32_t volatile ier;  ///< Interrupt enable register.
+        uint32_t volatile esr;  ///< Error status register.
+        uint32_t volatile btr;  ///< Bit timing register.
+    };
+
+    /**
+     * @brief Waits for the initialization acknowledge.
+     *
+     * @param isSet Wait for the acknowledge to be set, or cleared.
+     * @return true if the acknowledge has the value.
+     */
+    bool_t waitInitialization(bool_t isSet);
+
+    /**
+     * @brief bxCAN registers.
+     */
+    Registers& reg_;
+
+    /**
+     * @brief Time quantum frequency of the current bit timing, or zero if it is not changed.
+     */
+    uint32_t quantum_;
+
+    /**
+     * @brief The controller was in normal mode before the change.
+     */
+    bool_t isNormal_;
+
+};
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_CANRETIMING_HPP_
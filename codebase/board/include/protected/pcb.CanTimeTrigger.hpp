@@ -0,0 +1,246 @@
+/**
+ * @file      pcb.CanTimeTrigger.hpp
+ * @brief     EOOS CAN time-triggered communication
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_CANTIMETRIGGER_HPP_
+#define PCB_CANTIMETRIGGER_HPP_
+
+#include "lib.NonCopyable.hpp"
+#include "lib.NoAllocator.hpp"
+#include "drv.Can.hpp"
+#include "pcb.ClockListener.hpp"
+#include "pcb.Ramfunc.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @class CanTimeTrigger
+ * @brief Time stamps of CAN frames and a schedule table of cyclic frames.
+ *
+ * The object switches CAN1 to the time-triggered communication mode, in which the
+ * controller captures its 16-bit timer of bit times at the start of each frame. Frames
+ * of receive FIFO 1 are read with the time stamps, which are converted to cycles of
+ * pcb::Clock. The frames of a schedule table are put to transmit mailbox 2 by TIM4 compare
+ * interrupts at their offsets of a cycle, and the time stamp of a frame sent on an idle bus
+ * correlates the CAN timer with the clock up to one bit time.
+ *
+ * @note CAN1 must be initialized by the CAN driver before the object is constructed.
+ *       Receive FIFO 1 and transmit mailbox 2 are owned by the object while it exists,
+ *       and TIM4 is owned by the object, therefore only one object can exist.
+ *       The object listens to the clock scaler to retime TIM4 and the bit time, which is
+ *       read from CAN1 bit timing, so the object is to be added after pcb::CanRetiming.
+ */
+class CanTimeTrigger : public lib::NonCopyable<lib::NoAllocator>, public ClockListener
+{
+
+public:
+
+    /**
+     * @struct Entry
+     * @brief Entry of a schedule table.
+     */
+    struct Entry
+    {
+        uint32_t offset;                  ///< Offset from the cycle start in microseconds.
+        drv::Can::Message const* message; ///< Frame to be sent, which must exist until the schedule is stopped.
+        bool_t isTimeSent;                ///< Replaces the last two data bytes of a frame of eight bytes with the CAN time.
+    };
+
+    /**
+     * @struct TimedMessage
+     * @brief Received frame with its time stamp.
+     */
+    struct TimedMessage
+    {
+        drv::Can::Message message; ///< Frame.
+        uint32_t time;             ///< CAN time at the start of the frame in bit times, which wraps at 16 bits.
+        uint64_t cycles;           ///< Clock time at the start of the frame in cycles, if correlated.
+        bool_t isCorrelated;       ///< Clock time is valid.
+    };
+
+    /**
+     * @brief Maximum cycle of a schedule in microseconds.
+     */
+    static const uint32_t MAXIMUM_CYCLE = 0x10000U;
+
+    /**
+     * @brief Constructor.
+     */
+    CanTimeTrigger();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~CanTimeTrigger();
+
+    /**
+     * @brief Starts sending frames of a schedule table.
+     *
+     * @param entries Entries which offsets strictly increase, and which must exist until the schedule is stopped.
+     * @param number  Number of entries.
+     * @param cycle   Cycle of the schedule in microseconds, which is greater than the offsets.
+     * @return true if the schedule has been started.
+     */
+    bool_t start(Entry const* entries, int32_t number, uint32_t cycle);
+
+    /**
+     * @brief Stops sending frames.
+     */
+    void stop();
+
+    /**
+     * @brief Reads a frame of receive FIFO 1 with its time stamp.
+     *
+     * @param message Frame read.
+     * @return true if a frame has been read, or false if the FIFO is empty.
+     */
+    bool_t receive(TimedMessage* message);
+
+    /**
+     * @brief Converts CAN time to clock time.
+     *
+     * The CAN time must be within 32767 bit times of the last correlation,
+     * which is renewed by each frame of the schedule sent on an idle bus.
+     *
+     * @param time   CAN time in bit times.
+     * @param cycles Clock time in cycles.
+     * @return true if the times are correlated.
+     */
+    bool_t toCycles(uint32_t time, uint64_t* cycles) const;
+
+    /**
+     * @brief Returns clock cycles of one bit time.
+     *
+     * @return Number of cycles.
+     */
+    uint32_t getCyclesPerBit() const;
+
+    /**
+     * @brief Returns number of entries not sent as the mailbox had been busy.
+     *
+     * @return Number of entries.
+     */
+    uint32_t getMissed() const;
+
+    /**
+     * @copydoc eoos::pcb::ClockListener::suspend(ClockFrequencies const&, ClockFrequencies const&)
+     */
+    virtual bool_t suspend(ClockFrequencies const& current, ClockFrequencies const& next);
+
+    /**
+     * @copydoc eoos::pcb::ClockListener::resume(ClockFrequencies const&)
+     */
+    virtual void resume(ClockFrequencies const& frequencies);
+
+private:
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return true if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Sets the time-triggered communication mode.
+     *
+     * @param isEnabled Enables the mode, or disables it.
+     * @return true if the mode is set.
+     */
+    static bool_t setTimeTriggered(bool_t isEnabled);
+
+    /**
+     * @brief Sets the timer ticks and the bit time for clocks.
+     *
+     * @param frequencies Frequencies of the clocks.
+     */
+    void setTiming(ClockFrequencies const& frequencies);
+
+    /**
+     * @brief Takes the time stamp of the last frame sent on an idle bus.
+     */
+    void correlate();
+
+    /**
+     * @brief Puts a frame to transmit mailbox 2.
+     *
+     * @param entry Entry of the frame.
+     */
+    void send(Entry const& entry);
+
+    /**
+     * @brief Handles TIM4 interrupt.
+     */
+    EOOS_PCB_RAMFUNC static void handleTimer();
+
+    /**
+     * @brief The object owning TIM4.
+     */
+    static CanTimeTrigger* trigger_;
+
+    /**
+     * @brief Entries of the schedule.
+     */
+    Entry const* entries_;
+
+    /**
+     * @brief Number of entries.
+     */
+    int32_t number_;
+
+    /**
+     * @brief Index of the next entry to be sent.
+     */
+    int32_t next_;
+
+    /**
+     * @brief Timer ticks in a microsecond.
+     */
+    uint32_t ticksPerMicrosecond_;
+
+    /**
+     * @brief Clock cycles of one bit time.
+     */
+    uint32_t volatile cyclesPerBit_;
+
+    /**
+     * @brief Clock time of the request of the frame sent on an idle bus.
+     */
+    uint64_t requestCycles_;
+
+    /**
+     * @brief The frame sent on an idle bus is pending.
+     */
+    bool_t isRequested_;
+
+    /**
+     * @brief CAN time of the correlation.
+     */
+    uint32_t volatile referenceTime_;
+
+    /**
+     * @brief Clock time of the correlation.
+     */
+    uint64_t volatile referenceCycles_;
+
+    /**
+     * @brief The times are correlated.
+     */
+    bool_t volatile isCorrelated_;
+
+    /**
+     * @brief Number of entries not sent.
+     */
+    uint32_t volatile missed_;
+
+};
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_CANTIMETRIGGER_HPP_
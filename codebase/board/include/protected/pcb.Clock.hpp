@@ -0,0 +1,158 @@
+/**
+ * @file      pcb.Clock.hpp
+ * @brief     EOOS monotonic high-resolution clock
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_CLOCK_HPP_
+#define PCB_CLOCK_HPP_
+
+#include "lib.NonCopyable.hpp"
+#include "lib.NoAllocator.hpp"
+#include "pcb.ClockListener.hpp"
+#include "pcb.Handler.hpp"
+#include "pcb.Timer.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @class Clock
+ * @brief 64-bit monotonic clock of cycles of a constant frequency.
+ *
+ * The clock extends the 32-bit cycle counter by the time of the last reading,
+ * and a software timer reads the clock twice for one overflow of the counter,
+ * so that no overflow is missed. The time is read with the interrupts masked
+ * up to the kernel maximum syscall priority, therefore the functions can be called
+ * by threads and interrupt service routines of the priority not higher than that.
+ *
+ * The clock counts cycles of FREQUENCY in any clock profile. It listens to
+ * the clock changes and scales CPU cycles by FREQUENCY to the CPU clock,
+ * so that time and periods do not change when the CPU clock is lowered.
+ *
+ * @note Object of the class must be alone in the system and it is owned by the board.
+ */
+class Clock : public lib::NonCopyable<lib::NoAllocator>, public Handler, public ClockListener
+{
+
+public:
+
+    /**
+     * @brief Frequency of the clock in Hz, which is the CPU clock of the performance profile.
+     */
+    static const uint32_t FREQUENCY = 72000000U;
+
+    /**
+     * @brief Constructor.
+     */
+    Clock();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~Clock();
+
+    /**
+     * @copydoc eoos::pcb::Handler::handle()
+     */
+    virtual void handle();
+
+    /**
+     * @copydoc eoos::pcb::ClockListener::suspend(ClockFrequencies const&, ClockFrequencies const&)
+     */
+    virtual bool_t suspend(ClockFrequencies const& current, ClockFrequencies const& next);
+
+    /**
+     * @copydoc eoos::pcb::ClockListener::resume(ClockFrequencies const&)
+     */
+    virtual void resume(ClockFrequencies const& frequencies);
+
+    /**
+     * @brief Returns current time.
+     *
+     * @return Cycles since the counter is enabled.
+     */
+    static uint64_t getCycles();
+
+    /**
+     * @brief Returns current time.
+     *
+     * @return Nanoseconds since the counter is enabled.
+     */
+    static uint64_t getNanoseconds();
+
+    /**
+     * @brief Converts cycles to nanoseconds.
+     *
+     * @param cycles Cycles.
+     * @return Nanoseconds.
+     */
+    static uint64_t toNanoseconds(uint64_t cycles);
+
+    /**
+     * @brief Converts nanoseconds to cycles.
+     *
+     * @param nanoseconds Nanoseconds.
+     * @return Cycles.
+     */
+    static uint64_t toCycles(uint64_t nanoseconds);
+
+    /**
+     * @brief Sleeps the current thread until an absolute time.
+     *
+     * The thread is woken on the first kernel tick at or after the time, so that
+     * periodic loops which advance the time by a period do not drift.
+     *
+     * @param time Cycles to be woken at.
+     */
+    static void sleepUntil(uint64_t time);
+
+private:
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return true if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Period of reading the clock in milliseconds.
+     *
+     * The period is a half of the overflow period of the counter.
+     */
+    static const int32_t PERIOD = 29000;
+
+    /**
+     * @brief Nanoseconds in a second.
+     */
+    static const uint64_t NANOSECONDS = 1000000000U;
+
+    /**
+     * @brief Time of the last reading in cycles.
+     */
+    static uint64_t volatile time_;
+
+    /**
+     * @brief Cycle counter value of the last reading.
+     */
+    static uint32_t volatile counter_;
+
+    /**
+     * @brief Cycles of the clock in one CPU cycle.
+     */
+    static uint32_t volatile scale_;
+
+    /**
+     * @brief Timer of reading the clock.
+     */
+    Timer timer_;
+
+};
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_CLOCK_HPP_
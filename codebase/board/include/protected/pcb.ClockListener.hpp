@@ -0,0 +1,73 @@
+/**
+ * @file      pcb.ClockListener.hpp
+ * @brief     EOOS listener of clock frequency changes
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_CLOCKLISTENER_HPP_
+#define PCB_CLOCKLISTENER_HPP_
+
+#include "Types.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @struct ClockFrequencies
+ * @brief Frequencies of the bus clocks in Hz.
+ */
+struct ClockFrequencies
+{
+    uint32_t hclk;  ///< AHB clock, which is the CPU and SysTick clock.
+    uint32_t pclk1; ///< APB1 clock.
+    uint32_t pclk2; ///< APB2 clock.
+};
+
+/**
+ * @class ClockListener
+ * @brief Peripheral which timing is derived from the bus clocks.
+ *
+ * A listener is called by the clock scaler with the interrupts masked up to
+ * the kernel maximum syscall priority, so the functions must not block on the kernel.
+ */
+class ClockListener
+{
+
+public:
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~ClockListener() = 0;
+
+    /**
+     * @brief Prepares the peripheral to the change of the clocks.
+     *
+     * The function waits for the peripheral to finish a current frame,
+     * and checks that its timing can be derived from the next clocks.
+     *
+     * @param current Current frequencies.
+     * @param next    Frequencies to be set.
+     * @return true if the peripheral is ready to the change.
+     */
+    virtual bool_t suspend(ClockFrequencies const& current, ClockFrequencies const& next) = 0;
+
+    /**
+     * @brief Retimes the peripheral after the change of the clocks.
+     *
+     * The function is also called if the change is rejected, with the current frequencies.
+     *
+     * @param frequencies Frequencies which are set.
+     */
+    virtual void resume(ClockFrequencies const& frequencies) = 0;
+
+};
+
+inline ClockListener::~ClockListener() {}
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_CLOCKLISTENER_HPP_
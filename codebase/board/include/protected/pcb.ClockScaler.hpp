@@ -0,0 +1,180 @@
+/**
+ * @file      pcb.ClockScaler.hpp
+ * @brief     EOOS clock frequency scaling
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_CLOCKSCALER_HPP_
+#define PCB_CLOCKSCALER_HPP_
+
+#include "lib.NonCopyable.hpp"
+#include "lib.NoAllocator.hpp"
+#include "pcb.ClockListener.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @class ClockScaler
+ * @brief Switch of the system clock between clock profiles at run time.
+ *
+ * The system clock is switched between the PLL of the external oscillator and
+ * the external oscillator itself. Registered listeners are suspended before
+ * the switch and retimed after it, and the SysTick reload is recalculated,
+ * so that the kernel tick rate is kept.
+ *
+ * @note CycleCounter counts CPU cycles, so its conversions to time are valid
+ *       in the performance profile only. Clock keeps its frequency in any profile.
+ *
+ * @note Object of the class must be alone in the system and it is owned by the board.
+ */
+class ClockScaler : public lib::NonCopyable<lib::NoAllocator>
+{
+
+public:
+
+    /**
+     * @enum Profile
+     * @brief Clock profiles.
+     */
+    enum Profile
+    {
+        PROFILE_PERFORMANCE = 0, ///< SYSCLK of 72 MHz from PLL, APB1 of 36 MHz, APB2 of 72 MHz.
+        PROFILE_LOW_POWER   = 1  ///< SYSCLK of 8 MHz from HSE, APB1 and APB2 of 8 MHz, PLL off.
+    };
+
+    /**
+     * @brief Frequency of the external oscillator in Hz.
+     */
+    static const uint32_t HSE_FREQUENCY = 8000000U;
+
+    /**
+     * @brief Maximum number of listeners.
+     */
+    static const int32_t MAXIMUM_LISTENERS = 8;
+
+    /**
+     * @brief Constructor.
+     *
+     * The system is expected to be booted in the performance profile.
+     */
+    ClockScaler();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~ClockScaler();
+
+    /**
+     * @brief Adds a listener.
+     *
+     * @param listener Listener of the clock changes.
+     * @return true if the listener has been added.
+     */
+    bool_t addListener(ClockListener& listener);
+
+    /**
+     * @brief Removes a listener.
+     *
+     * @param listener Listener of the clock changes.
+     * @return true if the listener has been removed.
+     */
+    bool_t removeListener(ClockListener& listener);
+
+    /**
+     * @brief Switches the clocks to a profile.
+     *
+     * The switch is done with the interrupts masked up to the kernel maximum syscall
+     * priority. If any listener rejects the switch, the clocks are not changed.
+     *
+     * @param profile Profile to be set.
+     * @return true if the profile is set.
+     */
+    bool_t setProfile(Profile profile);
+
+    /**
+     * @brief Returns the current profile.
+     *
+     * @return The profile.
+     */
+    Profile getProfile() const;
+
+    /**
+     * @brief Returns the clock scaler of the system.
+     *
+     * @return The clock scaler, or NULLPTR if it is not constructed.
+     */
+    static ClockScaler* get();
+
+    /**
+     * @brief Returns frequencies of a profile.
+     *
+     * @param profile Profile.
+     * @return Frequencies of the bus clocks.
+     */
+    static ClockFrequencies getFrequencies(Profile profile);
+
+    /**
+     * @brief Returns frequencies of the current profile.
+     *
+     * @return Frequencies of the bus clocks, or of the performance profile if the clock scaler is not constructed.
+     */
+    static ClockFrequencies getFrequencies();
+
+    /**
+     * @brief Returns the clock of timers on APB1, such as TIM2 to TIM7.
+     *
+     * The timer clock is APB1 clock if APB1 prescaler is one, or twice APB1 clock otherwise.
+     *
+     * @param frequencies Frequencies of the bus clocks.
+     * @return Frequency of the timer clock.
+     */
+    static uint32_t getApb1TimerClock(ClockFrequencies const& frequencies);
+
+private:
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return true if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Switches RCC to a profile.
+     *
+     * @param profile Profile to be set.
+     * @return true if the clocks are switched.
+     */
+    static bool_t switchClocks(Profile profile);
+
+    /**
+     * @brief Sets SysTick reload for the kernel tick rate.
+     *
+     * @param hclk Frequency of AHB clock in Hz.
+     */
+    static void setTick(uint32_t hclk);
+
+    /**
+     * @brief Object of the class, as it must be alone.
+     */
+    static ClockScaler* scaler_;
+
+    /**
+     * @brief Listeners of the clock changes.
+     */
+    ClockListener* listeners_[MAXIMUM_LISTENERS];
+
+    /**
+     * @brief Current profile.
+     */
+    Profile profile_;
+
+};
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_CLOCKSCALER_HPP_
@@ -0,0 +1,71 @@
+/**
+ * @file      pcb.CriticalSection.hpp
+ * @brief     EOOS critical section of BASEPRI masking
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_CRITICALSECTION_HPP_
+#define PCB_CRITICALSECTION_HPP_
+
+#include "Types.hpp"
+#include "FreeRTOS.h"
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @class CriticalSection
+ * @brief Scoped critical section which masks interrupts by BASEPRI register.
+ *
+ * The interrupts of priorities up to configMAX_SYSCALL_INTERRUPT_PRIORITY, which
+ * are allowed to call the kernel, are masked from the object construction to its
+ * destruction. The interrupts of the zero-latency class above that level are not masked,
+ * so that the critical section does not add to their latency. The previous mask
+ * is restored on the destruction, therefore the sections can be nested and
+ * can be used by threads and interrupt service routines.
+ */
+class CriticalSection
+{
+
+public:
+
+    /**
+     * @brief Constructor which enters the critical section.
+     */
+    CriticalSection()
+        : mask_( portSET_INTERRUPT_MASK_FROM_ISR() ) {
+    }
+
+    /**
+     * @brief Destructor which leaves the critical section.
+     */
+    ~CriticalSection()
+    {
+        portCLEAR_INTERRUPT_MASK_FROM_ISR(mask_);
+    }
+
+private:
+
+    /**
+     * @brief Copy constructor.
+     */
+    CriticalSection(CriticalSection const&);
+
+    /**
+     * @brief Copy assignment operator.
+     */
+    CriticalSection& operator=(CriticalSection const&);
+
+    /**
+     * @brief The mask before the critical section.
+     */
+    UBaseType_t mask_;
+
+};
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_CRITICALSECTION_HPP_
@@ -0,0 +1,58 @@
+/**
+ * @file      pcb.CycleCounter.hpp
+ * @brief     EOOS CPU cycle counter
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_CYCLECOUNTER_HPP_
+#define PCB_CYCLECOUNTER_HPP_
+
+#include "Types.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @class CycleCounter
+ * @brief CPU cycle counter of Cortex-M3 Data Watchpoint and Trace unit.
+ *
+ * The counter is 32-bit and it overflows each 59 seconds at 72 MHz,
+ * therefore it is intended for measuring of short intervals.
+ */
+class CycleCounter
+{
+
+public:
+
+    /**
+     * @brief Enables the counter.
+     *
+     * @return true if the counter is running.
+     */
+    static bool_t initialize();
+
+    /**
+     * @brief Returns current value of the counter.
+     *
+     * @return CPU cycles.
+     */
+    static uint32_t get()
+    {
+        return *reinterpret_cast<uint32_t volatile*>(ADDRESS_DWT_CYCCNT);
+    }
+
+private:
+
+    /**
+     * @brief Address of DWT cycle count register.
+     */
+    static const uint32_t ADDRESS_DWT_CYCCNT = 0xE0001004U;
+
+};
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_CYCLECOUNTER_HPP_
@@ -0,0 +1,251 @@
+/**
+ * @file      pcb.EdgeCapture.hpp
+ * @brief     EOOS GPIO edge capture
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_EDGECAPTURE_HPP_
+#define PCB_EDGECAPTURE_HPP_
+
+#include "lib.NonCopyable.hpp"
+#include "lib.NoAllocator.hpp"
+#include "pcb.GpioPort.hpp"
+#include "pcb.Notifier.hpp"
+#include "pcb.Ramfunc.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @class EdgeCapture
+ * @brief Capture of GPIO input edges by EXTI interrupts.
+ *
+ * Each edge is stamped in the interrupt service routine with the CPU cycle counter
+ * and put to a lock-free buffer, which has one producer, the interrupt, and one consumer,
+ * the thread reading events. The consumer thread is notified when a batch of events
+ * is captured or a timeout expires, so that it is not woken on every edge.
+ */
+class EdgeCapture : public lib::NonCopyable<lib::NoAllocator>
+{
+
+public:
+
+    /**
+     * @enum Edge
+     * @brief Edges to capture.
+     */
+    enum Edge
+    {
+        EDGE_RISING  = 1, ///< Rising edges.
+        EDGE_FALLING = 2, ///< Falling edges.
+        EDGE_BOTH    = 3  ///< Rising and falling edges.
+    };
+
+    /**
+     * @struct Config
+     * @brief Capture configuration.
+     */
+    struct Config
+    {
+        GpioPort::Number port; ///< Port of the input.
+        int32_t pin;           ///< Pin of the input from 0 to 15.
+        Edge edge;             ///< Edges to capture.
+        bool_t pull;           ///< Input with pull-up or pull-down set by ODR, otherwise floating.
+        int32_t batch;         ///< Number of events to notify the reading thread.
+    };
+
+    /**
+     * @struct Event
+     * @brief Captured event.
+     */
+    struct Event
+    {
+        uint32_t time;  ///< CPU cycles of the edge.
+        uint32_t level; ///< Level of the input after the edge.
+    };
+
+    /**
+     * @brief Capacity of the event buffer.
+     */
+    static const int32_t CAPACITY = 64;
+
+    /**
+     * @brief Infinite timeout of waiting.
+     */
+    static const int32_t TIMEOUT_INFINITE = Notifier::TIMEOUT_INFINITE;
+
+    /**
+     * @brief Constructor.
+     *
+     * The constructor must be called by the thread, which will read events.
+     *
+     * @param config Capture configuration.
+     */
+    explicit EdgeCapture(Config const& config);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~EdgeCapture();
+
+    /**
+     * @brief Reads captured events.
+     *
+     * The function waits until a batch of events is captured or the timeout expires,
+     * and then returns the events captured so far.
+     *
+     * @param events  Buffer for the events.
+     * @param size    Size of the buffer in events.
+     * @param timeout Timeout in milliseconds, or TIMEOUT_INFINITE.
+     * @return Number of events read.
+     */
+    int32_t read(Event* events, int32_t size, int32_t timeout);
+
+    /**
+     * @brief Returns number of events lost due to the buffer overflow.
+     *
+     * @return Number of events.
+     */
+    uint32_t getLost() const;
+
+    /**
+     * @brief Generates software edge event.
+     *
+     * The function is useful for testing of the capture path without an input signal.
+     */
+    void generate();
+
+private:
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @param config Capture configuration.
+     * @return true if object has been constructed successfully.
+     */
+    bool_t construct(Config const& config);
+
+    /**
+     * @brief Captures an event in the interrupt service routine.
+     *
+     * @param time CPU cycles of the edge.
+     */
+    void capture(uint32_t time);
+
+    /**
+     * @brief Returns number of events in the buffer.
+     *
+     * @return Number of events.
+     */
+    int32_t getCount() const;
+
+    /**
+     * @brief Handles EXTI lines in the interrupt service routine.
+     *
+     * @param time  CPU cycles of the interrupt entry.
+     * @param first First line of the interrupt.
+     * @param last  Last line of the interrupt.
+     */
+    EOOS_PCB_RAMFUNC static void handle(uint32_t time, int32_t first, int32_t last);
+
+    /**
+     * @brief Interrupt service routine of EXTI line 0.
+     */
+    EOOS_PCB_RAMFUNC static void handleExti0();
+
+    /**
+     * @brief Interrupt service routine of EXTI line 1.
+     */
+    EOOS_PCB_RAMFUNC static void handleExti1();
+
+    /**
+     * @brief Interrupt service routine of EXTI line 2.
+     */
+    EOOS_PCB_RAMFUNC static void handleExti2();
+
+    /**
+     * @brief Interrupt service routine of EXTI line 3.
+     */
+    EOOS_PCB_RAMFUNC static void handleExti3();
+
+    /**
+     * @brief Interrupt service routine of EXTI line 4.
+     */
+    EOOS_PCB_RAMFUNC static void handleExti4();
+
+    /**
+     * @brief Interrupt service routine of EXTI lines from 5 to 9.
+     */
+    EOOS_PCB_RAMFUNC static void handleExti9To5();
+
+    /**
+     * @brief Interrupt service routine of EXTI lines from 10 to 15.
+     */
+    EOOS_PCB_RAMFUNC static void handleExti15To10();
+
+    /**
+     * @brief Returns interrupt request number of an EXTI line.
+     *
+     * @param line EXTI line.
+     * @return Interrupt request number.
+     */
+    static int32_t getIrq(int32_t line);
+
+    /**
+     * @brief Captures of EXTI lines.
+     */
+    static EdgeCapture* captures_[16];
+
+    /**
+     * @brief Port of the input.
+     */
+    GpioPort port_;
+
+    /**
+     * @brief Mask of the input pin and EXTI line.
+     */
+    uint32_t mask_;
+
+    /**
+     * @brief EXTI line.
+     */
+    int32_t line_;
+
+    /**
+     * @brief Number of events to notify the reading thread.
+     */
+    int32_t batch_;
+
+    /**
+     * @brief Notifier of the reading thread.
+     */
+    Notifier notifier_;
+
+    /**
+     * @brief Event buffer.
+     */
+    Event volatile events_[CAPACITY];
+
+    /**
+     * @brief Number of events written by the interrupt.
+     */
+    uint32_t volatile head_;
+
+    /**
+     * @brief Number of events read by the thread.
+     */
+    uint32_t volatile tail_;
+
+    /**
+     * @brief Number of events lost.
+     */
+    uint32_t volatile lost_;
+
+};
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_EDGECAPTURE_HPP_
@@ -0,0 +1,208 @@
+/**
+ * @file      pcb.EventGroup.hpp
+ * @brief     EOOS event group
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_EVENTGROUP_HPP_
+#define PCB_EVENTGROUP_HPP_
+
+#include "lib.NonCopyable.hpp"
+#include "lib.NoAllocator.hpp"
+#include "FreeRTOS.h"
+#include "event_groups.h"
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @class EventGroup
+ * @brief Group of event bits to wait on several event sources at once.
+ *
+ * The class is built on FreeRTOS event groups and allows one thread to wait
+ * for any or all of several events with a timeout, which are raised by other threads,
+ * drivers or interrupt service routines. The kernel object is allocated
+ * in the object itself, therefore no heap memory is used.
+ */
+class EventGroup : public lib::NonCopyable<lib::NoAllocator>
+{
+
+public:
+
+    /**
+     * @brief Infinite timeout of waiting.
+     */
+    static const int32_t TIMEOUT_INFINITE = -1;
+
+    /**
+     * @brief Mask of bits available for events.
+     *
+     * FreeRTOS reserves the upper 8 bits of an event group with 32-bit ticks.
+     */
+    static const uint32_t BITS_MASK = 0x00FFFFFFU;
+
+    /**
+     * @brief Constructor.
+     */
+    EventGroup();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~EventGroup();
+
+    /**
+     * @brief Sets event bits.
+     *
+     * @param bits Bits to be set.
+     * @return true if the bits have been set.
+     */
+    bool_t setBits(uint32_t bits);
+
+    /**
+     * @brief Sets event bits from an interrupt service routine.
+     *
+     * The bits are set by the FreeRTOS timer service task, which is requested
+     * from the interrupt, therefore the timer service must be enabled in the kernel.
+     *
+     * @param bits Bits to be set.
+     * @return true if the request has been posted.
+     */
+    bool_t setBitsFromInterrupt(uint32_t bits);
+
+    /**
+     * @brief Clears event bits.
+     *
+     * @param bits Bits to be cleared.
+     * @return Bits value before the bits were cleared.
+     */
+    uint32_t clearBits(uint32_t bits);
+
+    /**
+     * @brief Returns current event bits.
+     *
+     * @return Bits value.
+     */
+    uint32_t getBits() const;
+
+    /**
+     * @brief Waits for any of given bits.
+     *
+     * @param bits  Bits to wait for.
+     * @param timeout Timeout in milliseconds, or TIMEOUT_INFINITE.
+     * @param clear Clear the bits on exit.
+     * @return The bits which are set, or zero if the timeout expired.
+     */
+    uint32_t waitAny(uint32_t bits, int32_t timeout, bool_t clear = true);
+
+    /**
+     * @brief Waits for all of given bits.
+     *
+     * @param bits  Bits to wait for.
+     * @param timeout Timeout in milliseconds, or TIMEOUT_INFINITE.
+     * @param clear Clear the bits on exit.
+     * @return The bits given if all of them are set, or zero if the timeout expired.
+     */
+    uint32_t waitAll(uint32_t bits, int32_t timeout, bool_t clear = true);
+
+private:
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return true if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Waits for bits.
+     *
+     * @param bits  Bits to wait for.
+     * @param timeout Timeout in milliseconds, or TIMEOUT_INFINITE.
+     * @param clear Clear the bits on exit.
+     * @param all Wait for all the bits.
+     * @return The bits which satisfy the condition, or zero if the timeout expired.
+     */
+    uint32_t wait(uint32_t bits, int32_t timeout, bool_t clear, bool_t all);
+
+    /**
+     * @brief Converts milliseconds to kernel ticks.
+     *
+     * @param timeout Timeout in milliseconds, or TIMEOUT_INFINITE.
+     * @return Kernel ticks.
+     */
+    static TickType_t toTicks(int32_t timeout);
+
+    /**
+     * @brief FreeRTOS event group buffer.
+     */
+    StaticEventGroup_t buffer_;
+
+    /**
+     * @brief FreeRTOS event group handle.
+     */
+    EventGroupHandle_t handle_;
+
+};
+
+/**
+ * @class EventFlag
+ * @brief Event source which raises one bit of an event group.
+ *
+ * Objects of the class are given to event producers like drivers and interrupt
+ * service routines, so that they do not need to know about layout of the group bits.
+ */
+class EventFlag
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param group Event group to raise the bit in.
+     * @param bit   Bit number from 0 to 23.
+     */
+    EventFlag(EventGroup& group, int32_t bit);
+
+    /**
+     * @brief Returns mask of the bit.
+     *
+     * @return Bit mask.
+     */
+    uint32_t getMask() const;
+
+    /**
+     * @brief Raises the event.
+     *
+     * @return true if the event has been raised.
+     */
+    bool_t raise();
+
+    /**
+     * @brief Raises the event from an interrupt service routine.
+     *
+     * @return true if the event has been raised.
+     */
+    bool_t raiseFromInterrupt();
+
+private:
+
+    /**
+     * @brief Event group to raise the bit in.
+     */
+    EventGroup& group_;
+
+    /**
+     * @brief Mask of the bit.
+     */
+    uint32_t mask_;
+
+};
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_EVENTGROUP_HPP_
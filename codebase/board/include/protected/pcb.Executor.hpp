@@ -0,0 +1,328 @@
+/**
+ * @file      pcb.Executor.hpp
+ * @brief     EOOS executor of short jobs
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_EXECUTOR_HPP_
+#define PCB_EXECUTOR_HPP_
+
+#include "lib.NonCopyable.hpp"
+#include "lib.NoAllocator.hpp"
+#include "lib.AbstractThreadTask.hpp"
+#include "lib.Semaphore.hpp"
+#include "pcb.Job.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @class Executor<W,C>
+ * @brief Executor of short jobs on a fixed set of worker threads.
+ *
+ * The executor takes its workers from the thread pool once on construction,
+ * so that a job does not create and delete a thread. Jobs are queued by pointers
+ * in bounded priority lanes, and the workers take jobs from the highest lane first.
+ *
+ * @tparam W Number of worker threads.
+ * @tparam C Capacity of each lane.
+ */
+template <int32_t W = 2, int32_t C = 8>
+class Executor : public lib::NonCopyable<lib::NoAllocator>
+{
+    typedef lib::NonCopyable<lib::NoAllocator> Parent;
+
+public:
+
+    /**
+     * @enum Lane
+     * @brief Priority lanes of jobs.
+     */
+    enum Lane
+    {
+        LANE_HIGH   = 0, ///< Jobs executed first.
+        LANE_NORMAL = 1, ///< Jobs executed after high ones.
+        LANE_LOW    = 2  ///< Jobs executed when no other jobs are queued.
+    };
+
+    /**
+     * @brief Constructor.
+     */
+    Executor();
+
+    /**
+     * @brief Destructor.
+     *
+     * Completes all queued jobs and stops the workers.
+     */
+    virtual ~Executor();
+
+    /**
+     * @brief Submits a job for execution.
+     *
+     * @param job  Job to execute, which must not be queued already.
+     * @param lane Priority lane of the job.
+     * @return true if the job has been queued.
+     */
+    bool_t submit(Job& job, Lane lane = LANE_NORMAL);
+
+private:
+
+    /**
+     * @brief Number of priority lanes.
+     */
+    static const int32_t NUMBER_OF_LANES = 3;
+
+    /**
+     * @class Worker
+     * @brief Worker thread of the executor.
+     */
+    class Worker : public lib::AbstractThreadTask<>
+    {
+
+    public:
+
+        /**
+         * @brief Constructor.
+         */
+        Worker()
+            : lib::AbstractThreadTask<>()
+            , executor_( NULLPTR ) {
+        }
+
+        /**
+         * @brief Sets the executor to take jobs from.
+         *
+         * @param executor The executor.
+         */
+        void setExecutor(Executor& executor)
+        {
+            executor_ = &executor;
+        }
+
+    private:
+
+        /**
+         * @copydoc eoos::api::Task::start()
+         */
+        virtual void start()
+        {
+            if( executor_ != NULLPTR )
+            {
+                while( executor_->process() )
+                {
+                }
+            }
+        }
+
+        /**
+         * @brief The executor to take jobs from.
+         */
+        Executor* executor_;
+
+    };
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return true if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Waits for a job and executes it.
+     *
+     * @return true if a job has been executed, false if the executor is stopping.
+     */
+    bool_t process();
+
+    /**
+     * @brief Takes a job from the highest lane.
+     *
+     * @return The job, or NULLPTR if no jobs are queued.
+     */
+    Job* take();
+
+    /**
+     * @brief Stops the workers.
+     */
+    void stop();
+
+    /**
+     * @brief Number of queued jobs and stop requests.
+     */
+    lib::Semaphore<> jobs_;
+
+    /**
+     * @brief Queues of the lanes.
+     */
+    Job* queues_[NUMBER_OF_LANES][C];
+
+    /**
+     * @brief Indexes of the first jobs of the lanes.
+     */
+    int32_t heads_[NUMBER_OF_LANES];
+
+    /**
+     * @brief Numbers of jobs of the lanes.
+     */
+    int32_t counts_[NUMBER_OF_LANES];
+
+    /**
+     * @brief Stopping flag.
+     */
+    bool_t volatile isStopping_;
+
+    /**
+     * @brief Number of workers started.
+     */
+    int32_t started_;
+
+    /**
+     * @brief Worker threads.
+     */
+    Worker workers_[W];
+
+};
+
+template <int32_t W, int32_t C>
+Executor<W,C>::Executor()
+    : Parent()
+    , jobs_( 0 )
+    , queues_()
+    , heads_()
+    , counts_()
+    , isStopping_( false )
+    , started_( 0 )
+    , workers_() {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+template <int32_t W, int32_t C>
+Executor<W,C>::~Executor()
+{
+    stop();
+}
+
+template <int32_t W, int32_t C>
+bool_t Executor<W,C>::submit(Job& job, Lane const lane)
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() || isStopping_ )
+        {
+            break;
+        }
+        if( (lane < LANE_HIGH) || (lane > LANE_LOW) )
+        {
+            break;
+        }
+        taskENTER_CRITICAL();
+        if( counts_[lane] < C )
+        {
+            if( job.prepare() )
+            {
+                int32_t const tail( (heads_[lane] + counts_[lane]) % C );
+                queues_[lane][tail] = &job;
+                counts_[lane]++;
+                res = true;
+            }
+        }
+        taskEXIT_CRITICAL();
+        if( res )
+        {
+            res = jobs_.release();
+        }
+    } while(false);
+    return res;
+}
+
+template <int32_t W, int32_t C>
+bool_t Executor<W,C>::construct()
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {
+            break;
+        }
+        if( !jobs_.isConstructed() )
+        {
+            break;
+        }
+        for(int32_t i(0); i<W; i++)
+        {
+            workers_[i].setExecutor(*this);
+            if( !workers_[i].execute() )
+            {
+                break;
+            }
+            started_++;
+        }
+        if( started_ != W )
+        {
+            break;
+        }
+        res = true;
+    } while(false);
+    return res;
+}
+
+template <int32_t W, int32_t C>
+bool_t Executor<W,C>::process()
+{
+    bool_t res( false );
+    if( jobs_.acquire() )
+    {
+        Job* const job( take() );
+        if( job != NULLPTR )
+        {
+            job->execute();
+            res = true;
+        }
+    }
+    return res;
+}
+
+template <int32_t W, int32_t C>
+Job* Executor<W,C>::take()
+{
+    Job* job( NULLPTR );
+    taskENTER_CRITICAL();
+    for(int32_t lane(LANE_HIGH); lane<NUMBER_OF_LANES; lane++)
+    {
+        if( counts_[lane] != 0 )
+        {
+            job = queues_[lane][ heads_[lane] ];
+            heads_[lane] = (heads_[lane] + 1) % C;
+            counts_[lane]--;
+            break;
+        }
+    }
+    taskEXIT_CRITICAL();
+    return job;
+}
+
+template <int32_t W, int32_t C>
+void Executor<W,C>::stop()
+{
+    isStopping_ = true;
+    for(int32_t i(0); i<started_; i++)
+    {
+        static_cast<void>( jobs_.release() );
+    }
+    for(int32_t i(0); i<started_; i++)
+    {
+        static_cast<void>( workers_[i].join() );
+    }
+}
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_EXECUTOR_HPP_
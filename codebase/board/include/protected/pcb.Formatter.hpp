@@ -0,0 +1,197 @@
+/**
+ * @file      pcb.Formatter.hpp
+ * @brief     EOOS buffered formatter of output streams
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_FORMATTER_HPP_
+#define PCB_FORMATTER_HPP_
+
+#include "lib.NonCopyable.hpp"
+#include "lib.NoAllocator.hpp"
+#include "api.OutStream.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @class Formatter
+ * @brief Formatter of a line in a buffer, which is written to an output stream at once.
+ *
+ * Values are converted to the buffer, and the buffer is written to the stream
+ * by one call when a line feed is put, the buffer is full, or the formatter
+ * is flushed or destroyed. Integers are converted by a table of digit pairs
+ * and 32-bit divisions, which the CPU does in hardware, and 64-bit integers
+ * are reduced to 32-bit ones by subtractions of powers of ten without 64-bit division.
+ * A formatter is not thread-safe, so that each thread has its own one.
+ */
+class Formatter : public lib::NonCopyable<lib::NoAllocator>
+{
+
+public:
+
+    /**
+     * @struct Hex
+     * @brief Integer to be formatted in hexadecimal.
+     */
+    struct Hex
+    {
+        uint32_t value; ///< The integer.
+        int32_t digits; ///< Minimal number of digits.
+    };
+
+    /**
+     * @brief Size of the buffer in characters.
+     */
+    static const int32_t BUFFER_SIZE = 128;
+
+    /**
+     * @brief Maximum length of a converted integer in characters.
+     */
+    static const int32_t NUMBER_SIZE = 20;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param stream Stream to write lines to.
+     */
+    explicit Formatter(api::OutStream<char_t>& stream);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~Formatter();
+
+    /**
+     * @brief Puts a string.
+     *
+     * @param string String terminated by null character.
+     * @return This formatter.
+     */
+    Formatter& operator<<(char_t const* string);
+
+    /**
+     * @brief Puts a character.
+     *
+     * @param character Character.
+     * @return This formatter.
+     */
+    Formatter& operator<<(char_t character);
+
+    /**
+     * @brief Puts a signed integer in decimal.
+     *
+     * @param value Integer.
+     * @return This formatter.
+     */
+    Formatter& operator<<(int32_t value);
+
+    /**
+     * @brief Puts an unsigned integer in decimal.
+     *
+     * @param value Integer.
+     * @return This formatter.
+     */
+    Formatter& operator<<(uint32_t value);
+
+    /**
+     * @brief Puts a signed 64-bit integer in decimal.
+     *
+     * @param value Integer.
+     * @return This formatter.
+     */
+    Formatter& operator<<(int64_t value);
+
+    /**
+     * @brief Puts an unsigned 64-bit integer in decimal.
+     *
+     * @param value Integer.
+     * @return This formatter.
+     */
+    Formatter& operator<<(uint64_t value);
+
+    /**
+     * @brief Puts an integer in hexadecimal.
+     *
+     * @param value Integer.
+     * @return This formatter.
+     */
+    Formatter& operator<<(Hex value);
+
+    /**
+     * @brief Writes the buffer to the stream.
+     *
+     * @return This formatter.
+     */
+    Formatter& flush();
+
+    /**
+     * @brief Returns an integer to be formatted in hexadecimal.
+     *
+     * @param value  Integer.
+     * @param digits Minimal number of digits.
+     * @return The integer for formatting.
+     */
+    static Hex hex(uint32_t value, int32_t digits = 8);
+
+    /**
+     * @brief Converts an unsigned integer to decimal.
+     *
+     * @param value  Integer.
+     * @param string String of NUMBER_SIZE characters at least, which is not terminated.
+     * @return Number of characters.
+     */
+    static int32_t toDecimal(uint32_t value, char_t* string);
+
+    /**
+     * @brief Converts an unsigned 64-bit integer to decimal.
+     *
+     * @param value  Integer.
+     * @param string String of NUMBER_SIZE characters at least, which is not terminated.
+     * @return Number of characters.
+     */
+    static int32_t toDecimal(uint64_t value, char_t* string);
+
+    /**
+     * @brief Converts an integer to hexadecimal.
+     *
+     * @param value  Integer.
+     * @param digits Minimal number of digits.
+     * @param string String of NUMBER_SIZE characters at least, which is not terminated.
+     * @return Number of characters.
+     */
+    static int32_t toHexadecimal(uint32_t value, int32_t digits, char_t* string);
+
+private:
+
+    /**
+     * @brief Puts characters to the buffer.
+     *
+     * @param string Characters.
+     * @param length Number of characters.
+     */
+    void put(char_t const* string, int32_t length);
+
+    /**
+     * @brief Stream to write lines to.
+     */
+    api::OutStream<char_t>& stream_;
+
+    /**
+     * @brief Number of characters in the buffer.
+     */
+    int32_t length_;
+
+    /**
+     * @brief Buffer of a line with the terminating null character.
+     */
+    char_t buffer_[BUFFER_SIZE + 1];
+
+};
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_FORMATTER_HPP_
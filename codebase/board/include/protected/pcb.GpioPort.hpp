@@ -0,0 +1,278 @@
+/**
+ * @file      pcb.GpioPort.hpp
+ * @brief     EOOS port-wide GPIO access
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_GPIOPORT_HPP_
+#define PCB_GPIOPORT_HPP_
+
+#include "Types.hpp"
+#include "pcb.CriticalSection.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @class GpioPort
+ * @brief Port-wide atomic access to GPIO pins.
+ *
+ * The class sets, clears and writes any pins of a port by one write
+ * to BSRR or BRR register, so that no read-modify-write is done and no lock is needed,
+ * and reads all 16 pins of a port by one access to IDR register. Toggling reads ODR
+ * register before the write, so it is done in pcb::CriticalSection.
+ */
+class GpioPort
+{
+
+public:
+
+    /**
+     * @enum Number
+     * @brief GPIO port numbers of the MCU.
+     */
+    enum Number
+    {
+        NUMBER_A = 0,
+        NUMBER_B = 1,
+        NUMBER_C = 2,
+        NUMBER_D = 3,
+        NUMBER_E = 4
+    };
+
+    /**
+     * @enum Mode
+     * @brief Pin modes as MODE and CNF bits of CRL and CRH registers.
+     */
+    enum Mode
+    {
+        MODE_INPUT_FLOATING    = 0x4, ///< Floating input.
+        MODE_INPUT_PULL        = 0x8, ///< Input with pull-up or pull-down set by ODR.
+        MODE_OUTPUT_PUSH_PULL  = 0x3, ///< Push-pull output of 50 MHz.
+        MODE_OUTPUT_OPEN_DRAIN = 0x7  ///< Open-drain output of 50 MHz.
+    };
+
+    /**
+     * @struct Registers
+     * @brief GPIO port registers.
+     */
+    struct Registers
+    {
+        uint32_t volatile crl;  ///< Port configuration register low.
+        uint32_t volatile crh;  ///< Port configuration register high.
+        uint32_t volatile idr;  ///< Port input data register.
+        uint32_t volatile odr;  ///< Port output data register.
+        uint32_t volatile bsrr; ///< Port bit set/reset register.
+        uint32_t volatile brr;  ///< Port bit reset register.
+        uint32_t volatile lckr; ///< Port configuration lock register.
+    };
+
+    /**
+     * @brief Mask of all pins of a port.
+     */
+    static const uint32_t MASK_ALL = 0x0000FFFFU;
+
+    /**
+     * @brief Returns registers of a port.
+     *
+     * @param number Port number.
+     * @return The registers.
+     */
+    static Registers& getRegisters(Number number)
+    {
+        return *reinterpret_cast<Registers*>(ADDRESS_GPIOA + (static_cast<uint32_t>(number) * SIZE_GPIO));
+    }
+
+    /**
+     * @brief Constructor.
+     *
+     * @param number Port number.
+     */
+    explicit GpioPort(Number number);
+
+    /**
+     * @brief Returns the port number.
+     *
+     * @return Port number.
+     */
+    Number getNumber() const
+    {
+        return number_;
+    }
+
+    /**
+     * @brief Enables the port clock and configures pins.
+     *
+     * @param mask Pins to configure.
+     * @param mode Mode of the pins.
+     */
+    void configure(uint32_t mask, Mode mode);
+
+    /**
+     * @brief Sets pins to high level.
+     *
+     * @param mask Pins to set.
+     */
+    void set(uint32_t const mask)
+    {
+        reg_.bsrr = mask & MASK_ALL;
+    }
+
+    /**
+     * @brief Sets pins to low level.
+     *
+     * @param mask Pins to clear.
+     */
+    void clear(uint32_t const mask)
+    {
+        reg_.brr = mask & MASK_ALL;
+    }
+
+    /**
+     * @brief Inverts pins.
+     *
+     * @note The ODR read and the BSRR write are done in a critical section,
+     * so that a toggle of the same pins by an interrupt is not lost.
+     *
+     * @param mask Pins to toggle.
+     */
+    void toggle(uint32_t const mask)
+    {
+        CriticalSection const section;
+        uint32_t const odr( reg_.odr );
+        reg_.bsrr = ((odr & mask & MASK_ALL) << 16) | (~odr & mask & MASK_ALL);
+    }
+
+    /**
+     * @brief Writes value to pins.
+     *
+     * @param mask  Pins to write.
+     * @param value Value of the pins.
+     */
+    void write(uint32_t const mask, uint32_t const value)
+    {
+        reg_.bsrr = ((~value & mask & MASK_ALL) << 16) | (value & mask & MASK_ALL);
+    }
+
+    /**
+     * @brief Reads input levels of all pins.
+     *
+     * @return Levels of the pins.
+     */
+    uint32_t read() const
+    {
+        return reg_.idr & MASK_ALL;
+    }
+
+    /**
+     * @brief Reads output levels of all pins.
+     *
+     * @return Levels of the pins.
+     */
+    uint32_t readOutput() const
+    {
+        return reg_.odr & MASK_ALL;
+    }
+
+private:
+
+    /**
+     * @brief Address of GPIO port A.
+     */
+    static const uint32_t ADDRESS_GPIOA = 0x40010800U;
+
+    /**
+     * @brief Size of GPIO port address space.
+     */
+    static const uint32_t SIZE_GPIO = 0x00000400U;
+
+    /**
+     * @brief Port number.
+     */
+    Number number_;
+
+    /**
+     * @brief Port registers.
+     */
+    Registers& reg_;
+
+};
+
+/**
+ * @class GpioPins<N,M>
+ * @brief Compile-time set of pins of one port.
+ *
+ * All the functions are inlined, and all of them but toggle() to one access
+ * to a register of the port.
+ *
+ * @tparam N Port number.
+ * @tparam M Mask of the pins.
+ */
+template <GpioPort::Number N, uint32_t M>
+class GpioPins
+{
+
+public:
+
+    /**
+     * @brief Mask of the pins.
+     */
+    static const uint32_t MASK = M & GpioPort::MASK_ALL;
+
+    /**
+     * @brief Sets the pins to high level.
+     */
+    static void set()
+    {
+        GpioPort::getRegisters(N).bsrr = MASK;
+    }
+
+    /**
+     * @brief Sets the pins to low level.
+     */
+    static void clear()
+    {
+        GpioPort::getRegisters(N).brr = MASK;
+    }
+
+    /**
+     * @brief Inverts the pins.
+     *
+     * @note The ODR read and the BSRR write are done in a critical section.
+     */
+    static void toggle()
+    {
+        CriticalSection const section;
+        GpioPort::Registers& reg( GpioPort::getRegisters(N) );
+        uint32_t const odr( reg.odr );
+        reg.bsrr = ((odr & MASK) << 16) | (~odr & MASK);
+    }
+
+    /**
+     * @brief Writes value to the pins.
+     *
+     * @param value Value of the pins.
+     */
+    static void write(uint32_t const value)
+    {
+        GpioPort::getRegisters(N).bsrr = ((~value & MASK) << 16) | (value & MASK);
+    }
+
+    /**
+     * @brief Reads input levels of the pins.
+     *
+     * @return Levels of the pins.
+     */
+    static uint32_t read()
+    {
+        return GpioPort::getRegisters(N).idr & MASK;
+    }
+
+};
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_GPIOPORT_HPP_
@@ -0,0 +1,43 @@
+/**
+ * @file      pcb.Handler.hpp
+ * @brief     EOOS handler interface
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_HANDLER_HPP_
+#define PCB_HANDLER_HPP_
+
+#include "Types.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @class Handler
+ * @brief Handler of an event called back by board services.
+ */
+class Handler
+{
+
+public:
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~Handler() = 0;
+
+    /**
+     * @brief Handles the event.
+     */
+    virtual void handle() = 0;
+
+};
+
+inline Handler::~Handler() {}
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_HANDLER_HPP_
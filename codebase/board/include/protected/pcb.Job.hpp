@@ -0,0 +1,102 @@
+/**
+ * @file      pcb.Job.hpp
+ * @brief     EOOS job of an executor
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_JOB_HPP_
+#define PCB_JOB_HPP_
+
+#include "pcb.Notifier.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @class Job
+ * @brief Short job executed by a worker thread of an executor.
+ *
+ * A job object is owned by a caller and must exist until it is completed.
+ * The thread which submits a job can wait for the job completion, and as the
+ * completion is signaled by a direct to thread notification, the thread
+ * should not wait for other notifiers at the same time.
+ */
+class Job
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    Job();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~Job() = 0;
+
+    /**
+     * @brief Tests if the job is completed.
+     *
+     * @return true if the job is completed.
+     */
+    bool_t isCompleted() const;
+
+    /**
+     * @brief Waits for the job completion.
+     *
+     * @param timeout Timeout in milliseconds, or Notifier::TIMEOUT_INFINITE.
+     * @return true if the job is completed.
+     */
+    bool_t wait(int32_t timeout = Notifier::TIMEOUT_INFINITE);
+
+    /**
+     * @brief Prepares the job to be queued by the submitting thread.
+     *
+     * @return true if the job is prepared.
+     */
+    bool_t prepare();
+
+    /**
+     * @brief Executes the job by a worker and signals its completion.
+     */
+    void execute();
+
+protected:
+
+    /**
+     * @brief Runs the job.
+     */
+    virtual void run() = 0;
+
+private:
+
+    /**
+     * @brief Copy constructor.
+     */
+    Job(Job const&);
+
+    /**
+     * @brief Copy assignment operator.
+     */
+    Job& operator=(Job const&);
+
+    /**
+     * @brief Notifier of the submitting thread.
+     */
+    Notifier notifier_;
+
+    /**
+     * @brief Completion flag.
+     */
+    bool_t volatile isCompleted_;
+
+};
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_JOB_HPP_
@@ -0,0 +1,143 @@
+/**
+ * @file      pcb.Notifier.hpp
+ * @brief     EOOS direct to thread notifier
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_NOTIFIER_HPP_
+#define PCB_NOTIFIER_HPP_
+
+#include "lib.NonCopyable.hpp"
+#include "lib.NoAllocator.hpp"
+#include "FreeRTOS.h"
+#include "task.h"
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @class Notifier
+ * @brief Lightweight signal sent directly to one thread.
+ *
+ * The notifier is built on FreeRTOS direct to task notifications, so that
+ * no kernel object is allocated and a signal costs a few bytes of RAM
+ * and less cycles than a semaphore. The notifier is bound to one thread,
+ * which is the only one that can wait on it, and any thread or interrupt
+ * service routine can notify the bound thread. As the thread has one
+ * notification value, a thread should be bound to one notifier only.
+ *
+ * @note The notifier keeps the handle of the bound thread, so the thread must
+ *       unbind the notifier before it ends, or the notifier must be destroyed
+ *       before the thread ends.
+ */
+class Notifier : public lib::NonCopyable<lib::NoAllocator>
+{
+
+public:
+
+    /**
+     * @enum Type
+     * @brief Notifier types.
+     */
+    enum Type
+    {
+        TYPE_BINARY   = 0, ///< All pending notifications are consumed by one wait.
+        TYPE_COUNTING = 1  ///< Each wait consumes one pending notification.
+    };
+
+    /**
+     * @brief Infinite timeout of waiting.
+     */
+    static const int32_t TIMEOUT_INFINITE = -1;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param type Notifier type.
+     */
+    explicit Notifier(Type type = TYPE_BINARY);
+
+    /**
+     * @brief Destructor.
+     *
+     * The notifier is unbound from its thread.
+     */
+    virtual ~Notifier();
+
+    /**
+     * @brief Binds the notifier to the calling thread.
+     *
+     * The function must be called by the thread, which will wait on the notifier,
+     * for example on start of api::Task::start() function.
+     *
+     * @return true if the notifier has been bound.
+     */
+    bool_t bind();
+
+    /**
+     * @brief Unbinds the notifier from its thread.
+     */
+    void unbind();
+
+    /**
+     * @brief Tests if the notifier is bound to a thread.
+     *
+     * @return true if the notifier is bound.
+     */
+    bool_t isBound() const;
+
+    /**
+     * @brief Notifies the bound thread.
+     *
+     * @return true if the thread has been notified.
+     */
+    bool_t notify();
+
+    /**
+     * @brief Notifies the bound thread from an interrupt service routine.
+     *
+     * @return true if the thread has been notified.
+     */
+    bool_t notifyFromInterrupt();
+
+    /**
+     * @brief Waits for a notification.
+     *
+     * The function must be called by the bound thread only.
+     *
+     * @param timeout Timeout in milliseconds, or TIMEOUT_INFINITE.
+     * @return true if a notification has been taken.
+     */
+    bool_t wait(int32_t timeout = TIMEOUT_INFINITE);
+
+    /**
+     * @brief Drops pending notifications.
+     *
+     * The function must be called by the bound thread only, before it starts
+     * an operation which notifies it on completion, so that a notification
+     * of a previous operation does not complete the wait for the new one.
+     *
+     * @return true if the notifications have been dropped.
+     */
+    bool_t clear();
+
+private:
+
+    /**
+     * @brief Handle of the bound thread.
+     */
+    TaskHandle_t volatile task_;
+
+    /**
+     * @brief Notifier type.
+     */
+    Type type_;
+
+};
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_NOTIFIER_HPP_
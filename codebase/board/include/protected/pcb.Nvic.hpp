@@ -0,0 +1,187 @@
+/**
+ * @file      pcb.Nvic.hpp
+ * @brief     EOOS nested vectored interrupt controller
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_NVIC_HPP_
+#define PCB_NVIC_HPP_
+
+#include "pcb.Handler.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @class Nvic
+ * @brief Nested vectored interrupt controller with relocatable vector table.
+ *
+ * On the first handler setting the vector table is copied to SRAM with all
+ * the handlers set by the CPU layer and VTOR is pointed to the copy, so that
+ * board interrupts are bound to their handlers without the EOOS interrupt objects.
+ */
+class Nvic
+{
+
+public:
+
+    /**
+     * @brief Interrupt handler type.
+     */
+    typedef void (*Handler)();
+
+    /**
+     * @enum Irq
+     * @brief Interrupt request numbers of the MCU used by the board.
+     */
+    enum Irq
+    {
+        IRQ_EXTI0              = 6,
+        IRQ_EXTI1              = 7,
+        IRQ_EXTI2              = 8,
+        IRQ_EXTI3              = 9,
+        IRQ_EXTI4              = 10,
+        IRQ_DMA1_CHANNEL1      = 11,
+        IRQ_DMA1_CHANNEL2      = 12,
+        IRQ_DMA1_CHANNEL3      = 13,
+        IRQ_DMA1_CHANNEL4      = 14,
+        IRQ_DMA1_CHANNEL5      = 15,
+        IRQ_DMA1_CHANNEL6      = 16,
+        IRQ_DMA1_CHANNEL7      = 17,
+        IRQ_USB_HP_CAN1_TX     = 19,
+        IRQ_USB_LP_CAN1_RX0    = 20,
+        IRQ_CAN1_RX1           = 21,
+        IRQ_CAN1_SCE           = 22,
+        IRQ_EXTI9_5            = 23,
+        IRQ_TIM2               = 28,
+        IRQ_TIM3               = 29,
+        IRQ_TIM4               = 30,
+        IRQ_USART1             = 37,
+        IRQ_USART2             = 38,
+        IRQ_USART3             = 39,
+        IRQ_EXTI15_10          = 40,
+        IRQ_TIM5               = 50,
+        IRQ_TIM6               = 54,
+        IRQ_TIM7               = 55
+    };
+
+    /**
+     * @brief Number of interrupt requests of the MCU.
+     */
+    static const int32_t NUMBER_OF_IRQS = 60;
+
+    /**
+     * @brief Sets handler of an interrupt request.
+     *
+     * @param irq     Interrupt request number.
+     * @param handler Handler of the interrupt.
+     * @return true if the handler has been set.
+     */
+    static bool_t setHandler(int32_t irq, Handler handler);
+
+    /**
+     * @brief Returns handler of an interrupt request.
+     *
+     * @param irq Interrupt request number.
+     * @return The handler of the active vector table, or NULLPTR if the request is wrong.
+     */
+    static Handler getHandler(int32_t irq);
+
+    /**
+     * @brief Binds a handler object to an interrupt request.
+     *
+     * The interrupt vector is set to a common routine, which finds the handler
+     * of the active interrupt request in a table and calls it, so that handlers
+     * can be bound at run-time with a cost of the dispatch.
+     *
+     * @param irq     Interrupt request number.
+     * @param handler Handler of the interrupt.
+     * @return true if the handler has been bound.
+     */
+    static bool_t bind(int32_t irq, pcb::Handler& handler);
+
+    /**
+     * @brief Sets priority of an interrupt request.
+     *
+     * @param irq      Interrupt request number.
+     * @param priority Priority value of IPR register, which upper bits are significant only.
+     * @return true if the priority has been set.
+     */
+    static bool_t setPriority(int32_t irq, uint32_t priority);
+
+    /**
+     * @brief Returns priority of an interrupt request.
+     *
+     * @param irq Interrupt request number.
+     * @return Priority value of IPR register, or zero if the request is wrong.
+     */
+    static uint32_t getPriority(int32_t irq);
+
+    /**
+     * @brief Enables an interrupt request.
+     *
+     * @param irq Interrupt request number.
+     * @return true if the request has been enabled.
+     */
+    static bool_t enable(int32_t irq);
+
+    /**
+     * @brief Disables an interrupt request.
+     *
+     * @param irq Interrupt request number.
+     * @return true if the request has been disabled.
+     */
+    static bool_t disable(int32_t irq);
+
+    /**
+     * @brief Tests if an interrupt request is enabled.
+     *
+     * @param irq Interrupt request number.
+     * @return true if the request is enabled.
+     */
+    static bool_t isEnabled(int32_t irq);
+
+    /**
+     * @brief Clears pending state of an interrupt request.
+     *
+     * @param irq Interrupt request number.
+     * @return true if the state has been cleared.
+     */
+    static bool_t clearPending(int32_t irq);
+
+    /**
+     * @brief Sets pending state of an interrupt request.
+     *
+     * @param irq Interrupt request number.
+     * @return true if the state has been set.
+     */
+    static bool_t setPending(int32_t irq);
+
+private:
+
+    /**
+     * @brief Relocates the vector table to SRAM.
+     */
+    static void relocate();
+
+    /**
+     * @brief Calls the handler object bound to the active interrupt request.
+     */
+    static void dispatch();
+
+    /**
+     * @brief Tests if an interrupt request number is valid.
+     *
+     * @param irq Interrupt request number.
+     * @return true if the number is valid.
+     */
+    static bool_t isIrq(int32_t irq);
+
+};
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_NVIC_HPP_
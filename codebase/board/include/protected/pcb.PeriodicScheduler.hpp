@@ -0,0 +1,120 @@
+/**
+ * @file      pcb.PeriodicScheduler.hpp
+ * @brief     EOOS rate-monotonic scheduler of periodic tasks
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_PERIODICSCHEDULER_HPP_
+#define PCB_PERIODICSCHEDULER_HPP_
+
+#include "lib.NonCopyable.hpp"
+#include "lib.NoAllocator.hpp"
+#include "pcb.PeriodicTask.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @class PeriodicScheduler
+ * @brief Rate-monotonic scheduler of periodic tasks.
+ *
+ * The scheduler keeps its tasks ordered by their periods and assigns thread priorities
+ * from the highest one to the task of the shortest period. If there are more tasks than
+ * priorities, the last tasks share the lowest priority, and the analysis is not exact
+ * for them. Before the tasks are started, the response time analysis is done with
+ * worst-case execution times of the tasks, and the tasks are started only if each
+ * of them meets its deadline.
+ * All the tasks have the first release at the same time, which is the critical instant.
+ */
+class PeriodicScheduler : public lib::NonCopyable<lib::NoAllocator>
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    PeriodicScheduler();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~PeriodicScheduler();
+
+    /**
+     * @brief Adds a task to the scheduler.
+     *
+     * @param task Task to add.
+     * @return true if the task has been added.
+     */
+    bool_t add(PeriodicTask& task);
+
+    /**
+     * @brief Tests if the tasks meet their deadlines.
+     *
+     * The worst-case response time of each task is calculated with the
+     * worst-case execution times declared.
+     *
+     * @return true if the tasks are schedulable.
+     */
+    bool_t isSchedulable() const;
+
+    /**
+     * @brief Starts the tasks.
+     *
+     * @return true if the tasks are schedulable and have been started.
+     */
+    bool_t start();
+
+    /**
+     * @brief Stops the tasks and waits for their threads exit.
+     */
+    void stop();
+
+    /**
+     * @brief Returns processor utilization of the tasks.
+     *
+     * @return Utilization in percents.
+     */
+    int32_t getUtilization() const;
+
+private:
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return true if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Calculates worst-case response time of a task.
+     *
+     * @param task Task to calculate, which is interfered by the tasks before it in the list.
+     * @return CPU cycles, or the deadline plus one if the deadline is missed.
+     */
+    uint64_t getResponse(PeriodicTask const& task) const;
+
+    /**
+     * @brief Delay of the first release after the start in microseconds.
+     */
+    static const int32_t DELAY = 1000;
+
+    /**
+     * @brief List of the tasks ordered by their periods.
+     */
+    PeriodicTask* tasks_;
+
+    /**
+     * @brief The tasks are started.
+     */
+    bool_t isStarted_;
+
+};
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_PERIODICSCHEDULER_HPP_
@@ -0,0 +1,217 @@
+/**
+ * @file      pcb.PeriodicTask.hpp
+ * @brief     EOOS periodic task
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_PERIODICTASK_HPP_
+#define PCB_PERIODICTASK_HPP_
+
+#include "lib.AbstractThreadTask.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @class PeriodicTask
+ * @brief Thread task which runs a job periodically.
+ *
+ * Jobs are released at absolute times of the pcb::Clock, which are advanced
+ * by the period, so that the releases do not drift. Response time of each job
+ * from its release to its completion is put to a histogram, and jobs completed
+ * after the deadline are counted as misses. The time of each job from its start to its
+ * completion is compared to the declared worst-case execution time, and longer jobs are
+ * counted as overruns. As the time includes preemptions by tasks of higher priorities,
+ * it is exact for the task of the highest priority only. Tasks are started by
+ * pcb::PeriodicScheduler, which sets their priorities and the first release.
+ */
+class PeriodicTask : public lib::AbstractThreadTask<>
+{
+    typedef lib::AbstractThreadTask<> Parent;
+
+public:
+
+    /**
+     * @brief Number of bins of the response time histogram.
+     *
+     * The bins are of 1/8 of the deadline, and the last bin counts
+     * response times of twice the deadline and longer.
+     */
+    static const int32_t NUMBER_OF_BINS = 17;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param period   Period of the jobs in microseconds.
+     * @param deadline Deadline of the jobs relative to their release in microseconds.
+     * @param wcet     Worst-case execution time of a job in microseconds.
+     */
+    PeriodicTask(int32_t period, int32_t deadline, int32_t wcet);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~PeriodicTask();
+
+    /**
+     * @brief Stops releasing jobs.
+     *
+     * The thread completes the job it runs and exits.
+     */
+    void stop();
+
+    /**
+     * @brief Returns period.
+     *
+     * @return CPU cycles.
+     */
+    uint64_t getPeriod() const;
+
+    /**
+     * @brief Returns deadline.
+     *
+     * @return CPU cycles.
+     */
+    uint64_t getDeadline() const;
+
+    /**
+     * @brief Returns declared worst-case execution time.
+     *
+     * @return CPU cycles.
+     */
+    uint64_t getWcet() const;
+
+    /**
+     * @brief Returns number of completed jobs.
+     *
+     * @return Number of jobs.
+     */
+    uint32_t getJobs() const;
+
+    /**
+     * @brief Returns number of jobs completed after their deadlines.
+     *
+     * @return Number of jobs.
+     */
+    uint32_t getMisses() const;
+
+    /**
+     * @brief Returns number of jobs which ran from their starts to their completions
+     *        longer than the worst-case execution time.
+     *
+     * @return Number of jobs.
+     */
+    uint32_t getOverruns() const;
+
+    /**
+     * @brief Returns the longest response time.
+     *
+     * @return CPU cycles.
+     */
+    uint64_t getResponse() const;
+
+    /**
+     * @brief Returns number of jobs in a bin of the response time histogram.
+     *
+     * @param bin Bin number.
+     * @return Number of jobs.
+     */
+    uint32_t getHistogram(int32_t bin) const;
+
+protected:
+
+    /**
+     * @brief Runs a job.
+     */
+    virtual void run() = 0;
+
+private:
+
+    /**
+     * @copydoc eoos::api::Task::start()
+     */
+    virtual void start();
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @param period   Period of the jobs in microseconds.
+     * @param deadline Deadline of the jobs in microseconds.
+     * @param wcet     Worst-case execution time of a job in microseconds.
+     * @return true if object has been constructed successfully.
+     */
+    bool_t construct(int32_t period, int32_t deadline, int32_t wcet);
+
+    /**
+     * @brief Accounts a completed job.
+     *
+     * @param time     Time of the job from its start to its completion.
+     * @param response Response time of the job.
+     */
+    void account(uint64_t time, uint64_t response);
+
+    friend class PeriodicScheduler;
+
+    /**
+     * @brief Period in CPU cycles.
+     */
+    uint64_t period_;
+
+    /**
+     * @brief Deadline in CPU cycles.
+     */
+    uint64_t deadline_;
+
+    /**
+     * @brief Declared worst-case execution time in CPU cycles.
+     */
+    uint64_t wcet_;
+
+    /**
+     * @brief Longest response time in CPU cycles.
+     */
+    uint64_t response_;
+
+    /**
+     * @brief Release time of the next job.
+     */
+    uint64_t release_;
+
+    /**
+     * @brief Number of completed jobs.
+     */
+    uint32_t jobs_;
+
+    /**
+     * @brief Number of deadline misses.
+     */
+    uint32_t misses_;
+
+    /**
+     * @brief Number of worst-case execution time overruns.
+     */
+    uint32_t overruns_;
+
+    /**
+     * @brief Response time histogram.
+     */
+    uint32_t histogram_[NUMBER_OF_BINS];
+
+    /**
+     * @brief Releasing jobs is stopped.
+     */
+    bool_t volatile isStopped_;
+
+    /**
+     * @brief Next task in the list of a scheduler.
+     */
+    PeriodicTask* next_;
+
+};
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_PERIODICTASK_HPP_
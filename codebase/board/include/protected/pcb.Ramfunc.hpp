@@ -0,0 +1,27 @@
+/**
+ * @file      pcb.Ramfunc.hpp
+ * @brief     EOOS placement of functions to SRAM
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_RAMFUNC_HPP_
+#define PCB_RAMFUNC_HPP_
+
+#include "Types.hpp"
+
+/**
+ * @brief Places a function to SRAM.
+ *
+ * The function is linked to .ramfunc section, which is a part of .data section,
+ * so that it is copied from FLASH to SRAM by the boot code with initialized data
+ * and is executed without FLASH wait states. Calls of the function are long
+ * as SRAM is out of range of branch instructions from FLASH.
+ * The macro is put before a function declaration.
+ */
+#if defined(__GNUC__) && defined(__arm__)
+#define EOOS_PCB_RAMFUNC __attribute__((section(".ramfunc"), long_call, noinline))
+#else
+#define EOOS_PCB_RAMFUNC
+#endif
+
+#endif // PCB_RAMFUNC_HPP_
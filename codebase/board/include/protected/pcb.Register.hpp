@@ -0,0 +1,314 @@
+/**
+ * @file      pcb.Register.hpp
+ * @brief     EOOS typed access to peripheral registers
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_REGISTER_HPP_
+#define PCB_REGISTER_HPP_
+
+#include "Types.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @enum RegisterAccess
+ * @brief Access rights of a register.
+ */
+enum RegisterAccess
+{
+    REGISTER_ACCESS_RO    = 1, ///< Read-only register.
+    REGISTER_ACCESS_WO    = 2, ///< Write-only register.
+    REGISTER_ACCESS_RW    = 3, ///< Read-write register.
+    REGISTER_ACCESS_RC_W1 = 7  ///< Register which bits are read and cleared by writing one, so it cannot be modified.
+};
+
+/**
+ * @class Peripheral<ADDRESS>
+ * @brief Peripheral of the MCU address space.
+ *
+ * The class gives the base address of registers of a peripheral. A class with the same
+ * static function, which returns an address of a memory array, is given to registers instead
+ * of this class to retarget them to a simulated register file.
+ *
+ * @tparam ADDRESS Base address of the peripheral.
+ */
+template <uint32_t ADDRESS>
+class Peripheral
+{
+
+public:
+
+    /**
+     * @brief Returns the base address of the peripheral.
+     *
+     * @return The address.
+     */
+    static uint32_t getAddress()
+    {
+        return ADDRESS;
+    }
+
+};
+
+/**
+ * @class RegisterValue<R>
+ * @brief Values of fields of one register to be written at once.
+ *
+ * Values are created by fields and are merged by operator |, so that
+ * any number of fields are written by one store to the register.
+ * A value of one register cannot be merged with or written to another register.
+ *
+ * @tparam R Register.
+ */
+template <class R>
+class RegisterValue
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param mask Mask of the fields.
+     * @param bits Bits of the fields.
+     */
+    RegisterValue(uint32_t const mask, uint32_t const bits)
+        : mask_( mask )
+        , bits_( bits ) {
+    }
+
+    /**
+     * @brief Returns mask of the fields.
+     *
+     * @return The mask.
+     */
+    uint32_t getMask() const
+    {
+        return mask_;
+    }
+
+    /**
+     * @brief Returns bits of the fields.
+     *
+     * @return The bits.
+     */
+    uint32_t getBits() const
+    {
+        return bits_;
+    }
+
+    /**
+     * @brief Merges values of fields.
+     *
+     * @param value Values of other fields of the register.
+     * @return The merged values.
+     */
+    RegisterValue operator|(RegisterValue const& value) const
+    {
+        return RegisterValue(mask_ | value.mask_, (bits_ & ~value.mask_) | value.bits_);
+    }
+
+private:
+
+    /**
+     * @brief Mask of the fields.
+     */
+    uint32_t mask_;
+
+    /**
+     * @brief Bits of the fields.
+     */
+    uint32_t bits_;
+
+};
+
+/**
+ * @class Register<P,OFFSET,ACCESS>
+ * @brief Peripheral register with access rights checked at compile time.
+ *
+ * Reading a write-only register, writing a read-only register and modifying
+ * a register, which bits are cleared by writing one, are not compiled.
+ *
+ * @tparam P      Peripheral of the register.
+ * @tparam OFFSET Offset of the register from the base address of the peripheral.
+ * @tparam ACCESS Access rights of the register.
+ */
+template <class P, uint32_t OFFSET, RegisterAccess ACCESS = REGISTER_ACCESS_RW>
+class Register
+{
+
+public:
+
+    /**
+     * @brief Values of fields of the register.
+     */
+    typedef RegisterValue< Register<P,OFFSET,ACCESS> > Value;
+
+    /**
+     * @brief Reads the register.
+     *
+     * @return Value of the register.
+     */
+    static uint32_t read()
+    {
+        typedef char AccessCheck[ ((ACCESS & REGISTER_ACCESS_RO) != 0) ? 1 : -1 ];
+        static_cast<void>( sizeof(AccessCheck) );
+        return get();
+    }
+
+    /**
+     * @brief Writes the register.
+     *
+     * @param value Value of the register.
+     */
+    static void write(uint32_t const value)
+    {
+        typedef char AccessCheck[ ((ACCESS & REGISTER_ACCESS_WO) != 0) ? 1 : -1 ];
+        static_cast<void>( sizeof(AccessCheck) );
+        get() = value;
+    }
+
+    /**
+     * @brief Writes fields of the register by one store.
+     *
+     * The other fields of the register are written with zero.
+     *
+     * @param value Values of the fields.
+     */
+    static void write(Value const& value)
+    {
+        write( value.getBits() );
+    }
+
+    /**
+     * @brief Modifies fields of the register by one load and one store.
+     *
+     * The other fields of the register keep their values.
+     *
+     * @param value Values of the fields.
+     */
+    static void modify(Value const& value)
+    {
+        typedef char AccessCheck[ (ACCESS == REGISTER_ACCESS_RW) ? 1 : -1 ];
+        static_cast<void>( sizeof(AccessCheck) );
+        uint32_t volatile& reg( get() );
+        reg = (reg & ~value.getMask()) | value.getBits();
+    }
+
+private:
+
+    /**
+     * @brief Returns the register.
+     *
+     * @return The register.
+     */
+    static uint32_t volatile& get()
+    {
+        return *reinterpret_cast<uint32_t volatile*>( P::getAddress() + OFFSET );
+    }
+
+    /**
+     * @brief Compile-time check of the register alignment.
+     */
+    typedef char OffsetCheck[ ((OFFSET & 0x3U) == 0U) ? 1 : -1 ];
+
+};
+
+/**
+ * @class RegisterField<R,SHIFT,WIDTH>
+ * @brief Field of a peripheral register with its mask and offset given at compile time.
+ *
+ * @tparam R     Register of the field.
+ * @tparam SHIFT Number of the least significant bit of the field.
+ * @tparam WIDTH Number of bits of the field.
+ */
+template <class R, uint32_t SHIFT, uint32_t WIDTH = 1U>
+class RegisterField
+{
+
+public:
+
+    /**
+     * @brief Mask of the field in the register.
+     */
+    static const uint32_t MASK = (0xFFFFFFFFU >> (32U - WIDTH)) << SHIFT;
+
+    /**
+     * @brief Returns value of the field to be written to the register.
+     *
+     * @param bits Value of the field.
+     * @return Value of the field in the register.
+     */
+    static typename R::Value value(uint32_t const bits)
+    {
+        return typename R::Value(MASK, (bits << SHIFT) & MASK);
+    }
+
+    /**
+     * @brief Returns value of the field to be set to all ones, which is a flag set for a one-bit field.
+     *
+     * @return Value of the field in the register.
+     */
+    static typename R::Value set()
+    {
+        return typename R::Value(MASK, MASK);
+    }
+
+    /**
+     * @brief Returns value of the field to be cleared.
+     *
+     * @return Value of the field in the register.
+     */
+    static typename R::Value clear()
+    {
+        return typename R::Value(MASK, 0U);
+    }
+
+    /**
+     * @brief Reads the field.
+     *
+     * @return Value of the field.
+     */
+    static uint32_t read()
+    {
+        return (R::read() & MASK) >> SHIFT;
+    }
+
+    /**
+     * @brief Tests the field of a value read from the register.
+     *
+     * @param reg Value of the register.
+     * @return true if any bit of the field is set.
+     */
+    static bool_t isSet(uint32_t const reg)
+    {
+        return (reg & MASK) != 0U;
+    }
+
+    /**
+     * @brief Modifies the field by one load and one store.
+     *
+     * @param bits Value of the field.
+     */
+    static void modify(uint32_t const bits)
+    {
+        R::modify( value(bits) );
+    }
+
+private:
+
+    /**
+     * @brief Compile-time check of the field to be in the register.
+     */
+    typedef char FieldCheck[ ((WIDTH >= 1U) && (WIDTH <= 32U) && (SHIFT + WIDTH <= 32U)) ? 1 : -1 ];
+
+};
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_REGISTER_HPP_
@@ -0,0 +1,112 @@
+/**
+ * @file      pcb.StacklessScheduler.hpp
+ * @brief     EOOS scheduler of stackless tasks
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_STACKLESSSCHEDULER_HPP_
+#define PCB_STACKLESSSCHEDULER_HPP_
+
+#include "lib.NonCopyable.hpp"
+#include "lib.NoAllocator.hpp"
+#include "pcb.StacklessTask.hpp"
+#include "pcb.EventGroup.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @class StacklessScheduler
+ * @brief Cooperative scheduler of stackless tasks.
+ *
+ * The scheduler resumes its tasks in round-robin order on the stack of the thread,
+ * which calls run() function. If no task is ready, the thread is blocked on the scheduler
+ * event group until a task wake time comes or an event bit is raised by an interrupt
+ * service routine or other thread through a pcb::EventFlag of the group.
+ */
+class StacklessScheduler : public lib::NonCopyable<lib::NoAllocator>
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    StacklessScheduler();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~StacklessScheduler();
+
+    /**
+     * @brief Adds a task to the scheduler.
+     *
+     * @param task Task to add.
+     * @return true if the task has been added.
+     */
+    bool_t add(StacklessTask& task);
+
+    /**
+     * @brief Runs the tasks until all of them exit.
+     *
+     * @return true if all the tasks have completed.
+     */
+    bool_t run();
+
+    /**
+     * @brief Returns event group to raise events for the tasks.
+     *
+     * @return The event group.
+     */
+    EventGroup& getEventGroup();
+
+private:
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return true if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Tests if a task is ready to be resumed.
+     *
+     * @param task Task to test.
+     * @param time Current kernel tick.
+     * @return true if the task is ready.
+     */
+    bool_t isReady(StacklessTask& task, uint32_t time);
+
+    /**
+     * @brief Returns time to wait for the nearest task wake time.
+     *
+     * @param time Current kernel tick.
+     * @return Time in milliseconds, or EventGroup::TIMEOUT_INFINITE.
+     */
+    int32_t getTimeout(uint32_t time) const;
+
+    /**
+     * @brief Event group of the tasks.
+     */
+    EventGroup group_;
+
+    /**
+     * @brief List of the tasks.
+     */
+    StacklessTask* tasks_;
+
+    /**
+     * @brief Events raised and not consumed by the tasks yet.
+     */
+    uint32_t pending_;
+
+};
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_STACKLESSSCHEDULER_HPP_
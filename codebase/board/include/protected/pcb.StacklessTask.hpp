@@ -0,0 +1,194 @@
+/**
+ * @file      pcb.StacklessTask.hpp
+ * @brief     EOOS stackless task
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_STACKLESSTASK_HPP_
+#define PCB_STACKLESSTASK_HPP_
+
+#include "Types.hpp"
+
+/**
+ * @brief Begins body of StacklessTask::run() function.
+ */
+#define EOOS_PCB_STACKLESS_BEGIN() \
+    switch( getLine() ) { case 0:
+
+/**
+ * @brief Ends body of StacklessTask::run() function.
+ */
+#define EOOS_PCB_STACKLESS_END() \
+    default: break; } setLine(0); return STATUS_EXITED
+
+/**
+ * @brief Yields control to other stackless tasks.
+ */
+#define EOOS_PCB_STACKLESS_YIELD() \
+    do { setLine(__LINE__); return STATUS_READY; case __LINE__:; } while(false)
+
+/**
+ * @brief Sleeps for given milliseconds.
+ *
+ * @param MS Time in milliseconds.
+ */
+#define EOOS_PCB_STACKLESS_SLEEP(MS) \
+    do { sleepFor(MS); setLine(__LINE__); return STATUS_WAITING; case __LINE__:; } while(false)
+
+/**
+ * @brief Waits for any of event bits of the scheduler with a timeout.
+ *
+ * After the wait getBits() returns the received bits, or zero if the timeout expired.
+ *
+ * @param BITS Event bits to wait for.
+ * @param MS   Timeout in milliseconds, or StacklessTask::TIMEOUT_INFINITE.
+ */
+#define EOOS_PCB_STACKLESS_WAIT(BITS, MS) \
+    do { waitFor(BITS, MS); setLine(__LINE__); return STATUS_WAITING; case __LINE__:; } while(false)
+
+namespace eoos
+{
+namespace pcb
+{
+
+class StacklessScheduler;
+
+/**
+ * @class StacklessTask
+ * @brief Task without own stack executed cooperatively by a scheduler.
+ *
+ * A task is a state machine, which keeps its state in members of the class instead
+ * of a stack, and all tasks of a scheduler share the stack of the thread running
+ * the scheduler. The run() function of a task is written between EOOS_PCB_STACKLESS_BEGIN()
+ * and EOOS_PCB_STACKLESS_END() macros and returns control to the scheduler by the wait macros,
+ * after which the function is resumed from the point it returned.
+ *
+ * @note Local variables of run() function are not saved between resumptions,
+ *       and two macros of the task may not be placed on one source line.
+ */
+class StacklessTask
+{
+
+public:
+
+    /**
+     * @brief Infinite timeout of waiting.
+     */
+    static const int32_t TIMEOUT_INFINITE = -1;
+
+    /**
+     * @brief Constructor.
+     */
+    StacklessTask();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~StacklessTask() = 0;
+
+protected:
+
+    /**
+     * @enum Status
+     * @brief Status of the task returned by run() function.
+     */
+    enum Status
+    {
+        STATUS_READY   = 0, ///< The task is ready to be resumed.
+        STATUS_WAITING = 1, ///< The task waits for time or events.
+        STATUS_EXITED  = 2  ///< The task has completed.
+    };
+
+    /**
+     * @brief Runs the task until it waits or exits.
+     *
+     * @return Status of the task.
+     */
+    virtual Status run() = 0;
+
+    /**
+     * @brief Returns the point the task will be resumed from.
+     *
+     * @return Line number of the point.
+     */
+    int32_t getLine() const;
+
+    /**
+     * @brief Sets the point the task will be resumed from.
+     *
+     * @param line Line number of the point.
+     */
+    void setLine(int32_t line);
+
+    /**
+     * @brief Sets the task to sleep.
+     *
+     * @param time Time in milliseconds.
+     */
+    void sleepFor(int32_t time);
+
+    /**
+     * @brief Sets the task to wait for events.
+     *
+     * @param bits    Event bits of the scheduler to wait for.
+     * @param timeout Timeout in milliseconds, or TIMEOUT_INFINITE.
+     */
+    void waitFor(uint32_t bits, int32_t timeout);
+
+    /**
+     * @brief Returns event bits received by the last wait.
+     *
+     * @return The bits, or zero if the timeout expired.
+     */
+    uint32_t getBits() const;
+
+private:
+
+    friend class StacklessScheduler;
+
+    /**
+     * @brief Copy constructor.
+     */
+    StacklessTask(StacklessTask const&);
+
+    /**
+     * @brief Copy assignment operator.
+     */
+    StacklessTask& operator=(StacklessTask const&);
+
+    /**
+     * @brief Line of the resumption point.
+     */
+    int32_t line_;
+
+    /**
+     * @brief Task is waiting for wake time.
+     */
+    bool_t isTimed_;
+
+    /**
+     * @brief Kernel tick to wake the task.
+     */
+    uint32_t wakeTime_;
+
+    /**
+     * @brief Event bits to wait for.
+     */
+    uint32_t waitBits_;
+
+    /**
+     * @brief Event bits received.
+     */
+    uint32_t bits_;
+
+    /**
+     * @brief Next task of the scheduler.
+     */
+    StacklessTask* next_;
+
+};
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_STACKLESSTASK_HPP_
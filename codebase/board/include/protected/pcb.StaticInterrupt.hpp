@@ -0,0 +1,94 @@
+/**
+ * @file      pcb.StaticInterrupt.hpp
+ * @brief     EOOS interrupt with a handler bound at compile time
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_STATICINTERRUPT_HPP_
+#define PCB_STATICINTERRUPT_HPP_
+
+#include "pcb.Nvic.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @class StaticInterrupt<IRQ,HANDLER>
+ * @brief Interrupt request with a handler function given at compile time.
+ *
+ * The handler function is put to the interrupt vector directly, so that the CPU
+ * jumps to it with no table lookup and virtual call of the EOOS interrupt objects
+ * or pcb::Nvic::bind() dispatch. The class has no objects and all its functions
+ * are reduced to one access to an NVIC register.
+ *
+ * @tparam IRQ     Interrupt request number.
+ * @tparam HANDLER Handler function.
+ */
+template <int32_t IRQ, Nvic::Handler HANDLER>
+class StaticInterrupt
+{
+
+    /**
+     * @brief Compile-time check of the interrupt request number.
+     */
+    typedef char IrqCheck[ ((IRQ >= 0) && (IRQ < Nvic::NUMBER_OF_IRQS)) ? 1 : -1 ];
+
+public:
+
+    /**
+     * @brief Interrupt request number.
+     */
+    static const int32_t NUMBER = IRQ;
+
+    /**
+     * @brief Puts the handler to the interrupt vector.
+     *
+     * @return true if the handler has been set.
+     */
+    static bool_t bind()
+    {
+        return Nvic::setHandler(IRQ, HANDLER);
+    }
+
+    /**
+     * @brief Sets priority of the interrupt request.
+     *
+     * @param priority Priority value of IPR register.
+     */
+    static void setPriority(uint32_t const priority)
+    {
+        static_cast<void>( Nvic::setPriority(IRQ, priority) );
+    }
+
+    /**
+     * @brief Enables the interrupt request.
+     */
+    static void enable()
+    {
+        static_cast<void>( Nvic::enable(IRQ) );
+    }
+
+    /**
+     * @brief Disables the interrupt request.
+     */
+    static void disable()
+    {
+        static_cast<void>( Nvic::disable(IRQ) );
+    }
+
+    /**
+     * @brief Requests the interrupt by software.
+     */
+    static void trigger()
+    {
+        static_cast<void>( Nvic::setPending(IRQ) );
+    }
+
+};
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_STATICINTERRUPT_HPP_
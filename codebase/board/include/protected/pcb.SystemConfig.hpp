@@ -0,0 +1,38 @@
+/**
+ * @file      pcb.SystemConfig.hpp
+ * @brief     EOOS system descriptor of the project
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_SYSTEMCONFIG_HPP_
+#define PCB_SYSTEMCONFIG_HPP_
+
+#include "pcb.SystemDescriptor.hpp"
+
+#if !defined(EOOS_GLOBAL_SYS_NUMBER_OF_THREADS) || !defined(EOOS_GLOBAL_SYS_FREERTOS_TASK_STACK_SIZE)
+    #error "EOOS global configuration of threads is not defined"
+#endif
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @brief System descriptor of the EOOS global configuration of the project.
+ *
+ * The EOOS system and drivers are configured by EOOS_GLOBAL_* definitions,
+ * and the descriptor brings them to the compile-time checks and constants,
+ * so that code does not need #if chains on the definitions.
+ */
+typedef SystemDescriptor<
+    EOOS_GLOBAL_SYS_NUMBER_OF_THREADS,
+    EOOS_GLOBAL_SYS_FREERTOS_TASK_STACK_SIZE,
+    EOOS_GLOBAL_SYS_NUMBER_OF_MUTEXS,
+    EOOS_GLOBAL_SYS_NUMBER_OF_SEMAPHORES
+> SystemConfig;
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_SYSTEMCONFIG_HPP_
@@ -0,0 +1,108 @@
+/**
+ * @file      pcb.SystemDescriptor.hpp
+ * @brief     EOOS compile-time system descriptor
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_SYSTEMDESCRIPTOR_HPP_
+#define PCB_SYSTEMDESCRIPTOR_HPP_
+
+#include "Types.hpp"
+#include "FreeRTOS.h"
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @class SystemDescriptor<THREADS,STACK_SIZE,MUTEXES,SEMAPHORES>
+ * @brief Description of the system resources an application declares.
+ *
+ * The descriptor gives the numbers of resource objects as compile-time constants,
+ * calculates SRAM taken by the kernel objects and stacks of the pools,
+ * and checks at compile time that they fit in the SRAM budget of the linker script.
+ * Resources, which an application does not declare, are given zero.
+ *
+ * Only the pools of which object sizes are known to the board are described.
+ * Objects of the other pools, like interrupts and drivers, are in the static data,
+ * which the linker checks to fit in SRAM with the heap and the main stack.
+ *
+ * @tparam THREADS    Number of threads.
+ * @tparam STACK_SIZE Stack size of a thread in bytes.
+ * @tparam MUTEXES    Number of mutexes.
+ * @tparam SEMAPHORES Number of semaphores.
+ */
+template <
+    int32_t THREADS,
+    int32_t STACK_SIZE,
+    int32_t MUTEXES = 0,
+    int32_t SEMAPHORES = 0
+>
+class SystemDescriptor
+{
+
+public:
+
+    static const int32_t NUMBER_OF_THREADS = THREADS;           ///< Number of threads.
+    static const int32_t THREAD_STACK_SIZE = STACK_SIZE;        ///< Stack size of a thread in bytes.
+    static const int32_t NUMBER_OF_MUTEXES = MUTEXES;           ///< Number of mutexes.
+    static const int32_t NUMBER_OF_SEMAPHORES = SEMAPHORES;     ///< Number of semaphores.
+
+    /**
+     * @brief Size of SRAM region of the linker script.
+     *
+     * The linker scripts assert LENGTH(SRAM) to be equal to the value.
+     */
+    static const uint32_t SRAM_SIZE = 0x00010000U;
+
+    /**
+     * @brief SRAM reserved by the linker script for the heap and the main stack.
+     *
+     * The linker scripts assert _Min_Heap_Size plus _Min_Stack_Size to be equal to the value.
+     */
+    static const uint32_t SRAM_RESERVED = 0x00000200U + 0x00000400U;
+
+    /**
+     * @brief SRAM taken by the thread pool with the stacks in bytes.
+     */
+    static const uint32_t THREADS_MEMORY = static_cast<uint32_t>(THREADS) * (static_cast<uint32_t>(STACK_SIZE) + sizeof(StaticTask_t));
+
+    /**
+     * @brief SRAM taken by the kernel objects of mutexes and semaphores in bytes.
+     */
+    static const uint32_t SYNCHRONIZATION_MEMORY = static_cast<uint32_t>(MUTEXES + SEMAPHORES) * sizeof(StaticSemaphore_t);
+
+    /**
+     * @brief SRAM taken by the pools in bytes.
+     */
+    static const uint32_t MEMORY = THREADS_MEMORY + SYNCHRONIZATION_MEMORY;
+
+    /**
+     * @brief SRAM left for the other data in bytes.
+     */
+    static const uint32_t MEMORY_LEFT = SRAM_SIZE - SRAM_RESERVED - MEMORY;
+
+private:
+
+    /**
+     * @brief Compile-time check of the numbers of resources.
+     */
+    typedef char NumberCheck[ ((THREADS >= 0) && (MUTEXES >= 0) && (SEMAPHORES >= 0)) ? 1 : -1 ];
+
+    /**
+     * @brief Compile-time check of the stack size to be word aligned and not less than the kernel minimum.
+     */
+    typedef char StackCheck[ ((THREADS == 0) || (((STACK_SIZE % 4) == 0) && (STACK_SIZE >= static_cast<int32_t>(configMINIMAL_STACK_SIZE * sizeof(StackType_t))))) ? 1 : -1 ];
+
+    /**
+     * @brief Compile-time check of the pools to fit in SRAM budget.
+     */
+    typedef char MemoryCheck[ (MEMORY <= SRAM_SIZE - SRAM_RESERVED) ? 1 : -1 ];
+
+};
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_SYSTEMDESCRIPTOR_HPP_
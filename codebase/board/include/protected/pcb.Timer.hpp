@@ -0,0 +1,164 @@
+/**
+ * @file      pcb.Timer.hpp
+ * @brief     EOOS software timer
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_TIMER_HPP_
+#define PCB_TIMER_HPP_
+
+#include "lib.NonCopyable.hpp"
+#include "lib.NoAllocator.hpp"
+#include "pcb.Handler.hpp"
+#include "FreeRTOS.h"
+#include "timers.h"
+#include "semphr.h"
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @class Timer
+ * @brief Software timer of FreeRTOS timer service.
+ *
+ * The timer calls its handler on the FreeRTOS timer service task, so that
+ * a periodic job does not need a thread and its stack. The kernel object is
+ * allocated in the object itself, therefore no heap memory is used.
+ * A handler must not block as it is executed by the timer service task
+ * shared with all the timers.
+ *
+ * The destructor waits until the timer service task has deleted the kernel timer,
+ * therefore a timer must not be destroyed by a handler of the timer service task.
+ */
+class Timer : public lib::NonCopyable<lib::NoAllocator>
+{
+
+public:
+
+    /**
+     * @enum Mode
+     * @brief Timer modes.
+     */
+    enum Mode
+    {
+        MODE_ONE_SHOT = 0, ///< Timer expires once after it is started.
+        MODE_PERIODIC = 1  ///< Timer expires periodically until it is stopped.
+    };
+
+    /**
+     * @brief Constructor.
+     *
+     * @param handler Handler to be called on the timer expiration.
+     * @param mode    Timer mode.
+     * @param period  Period of the timer in milliseconds.
+     */
+    Timer(Handler& handler, Mode mode, int32_t period);
+
+    /**
+     * @brief Destructor.
+     *
+     * The function returns after the timer service task has deleted the kernel
+     * timer, so that the buffer of the timer is not used after the object is freed.
+     */
+    virtual ~Timer();
+
+    /**
+     * @brief Starts or restarts the timer.
+     *
+     * @return true if the timer has been started.
+     */
+    bool_t start();
+
+    /**
+     * @brief Stops the timer.
+     *
+     * @return true if the timer has been stopped.
+     */
+    bool_t stop();
+
+    /**
+     * @brief Starts or restarts the timer from an interrupt service routine.
+     *
+     * @return true if the timer has been started.
+     */
+    bool_t startFromInterrupt();
+
+    /**
+     * @brief Stops the timer from an interrupt service routine.
+     *
+     * @return true if the timer has been stopped.
+     */
+    bool_t stopFromInterrupt();
+
+    /**
+     * @brief Sets new period of the timer and starts it.
+     *
+     * @param period Period of the timer in milliseconds.
+     * @return true if the period has been set.
+     */
+    bool_t setPeriod(int32_t period);
+
+    /**
+     * @brief Tests if the timer is running.
+     *
+     * @return true if the timer is running.
+     */
+    bool_t isActive() const;
+
+private:
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @param mode   Timer mode.
+     * @param period Period of the timer in milliseconds.
+     * @return true if object has been constructed successfully.
+     */
+    bool_t construct(Mode mode, int32_t period);
+
+    /**
+     * @brief Converts milliseconds to kernel ticks.
+     *
+     * @param period Period in milliseconds.
+     * @return Kernel ticks, or zero if the period is wrong.
+     */
+    static TickType_t toTicks(int32_t period);
+
+    /**
+     * @brief Callback of FreeRTOS timer service.
+     *
+     * @param timer Expired timer handle.
+     */
+    static void callback(TimerHandle_t timer);
+
+    /**
+     * @brief Releases the destructor pended after the delete command.
+     *
+     * @param semaphore Semaphore the destructor waits for.
+     * @param unused    Unused parameter.
+     */
+    static void release(void* semaphore, uint32_t unused);
+
+    /**
+     * @brief Handler to be called on the timer expiration.
+     */
+    Handler& handler_;
+
+    /**
+     * @brief FreeRTOS timer buffer.
+     */
+    StaticTimer_t buffer_;
+
+    /**
+     * @brief FreeRTOS timer handle.
+     */
+    TimerHandle_t handle_;
+
+};
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_TIMER_HPP_
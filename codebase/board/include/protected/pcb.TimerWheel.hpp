@@ -0,0 +1,205 @@
+/**
+ * @file      pcb.TimerWheel.hpp
+ * @brief     EOOS hierarchical timer wheel
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_TIMERWHEEL_HPP_
+#define PCB_TIMERWHEEL_HPP_
+
+#include "lib.NonCopyable.hpp"
+#include "lib.NoAllocator.hpp"
+#include "pcb.Handler.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @class TimerWheel
+ * @brief Hierarchical timer wheel for hundreds of software timers.
+ *
+ * The wheel has four levels of 32 slots, each slot is a list of timers, so that
+ * starting and stopping of a timer costs O(1) regardless of number of timers.
+ * The wheel is advanced by the tick() function, which is usually called by
+ * a periodic pcb::Timer, and handlers of expired timers are called on the context of
+ * the tick() caller. Timers are owned by a caller and are not allocated by the wheel.
+ */
+class TimerWheel : public lib::NonCopyable<lib::NoAllocator>
+{
+
+    /**
+     * @struct Node
+     * @brief Node of a circular doubly linked list of a slot.
+     */
+    struct Node
+    {
+        Node* prev; ///< Previous node.
+        Node* next; ///< Next node.
+    };
+
+public:
+
+    /**
+     * @brief Maximum delay of a timer in ticks.
+     */
+    static const uint32_t MAXIMUM_DELAY = 0x000FFFFFU;
+
+    /**
+     * @class Entry
+     * @brief Timer of the wheel.
+     */
+    class Entry
+    {
+
+    public:
+
+        /**
+         * @brief Constructor.
+         *
+         * @param handler Handler to be called on the timer expiration.
+         */
+        explicit Entry(Handler& handler);
+
+        /**
+         * @brief Tests if the timer is running.
+         *
+         * @return true if the timer is running.
+         */
+        bool_t isActive() const;
+
+    private:
+
+        friend class TimerWheel;
+
+        Node node_;         ///< Node of a slot list, must be the first member.
+        Handler* handler_;  ///< Handler to be called on the timer expiration.
+        uint32_t expiry_;   ///< Absolute tick of the expiration.
+        uint32_t period_;   ///< Period in ticks, or zero for one-shot.
+        bool_t isActive_;   ///< Running flag.
+
+    };
+
+    /**
+     * @brief Constructor.
+     */
+    TimerWheel();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~TimerWheel();
+
+    /**
+     * @brief Starts or restarts a timer.
+     *
+     * @param entry  Timer to start.
+     * @param delay  Delay before the first expiration in ticks from 1 to MAXIMUM_DELAY.
+     * @param period Period in ticks, or zero for one-shot timer.
+     * @return true if the timer has been started.
+     */
+    bool_t start(Entry& entry, uint32_t delay, uint32_t period = 0U);
+
+    /**
+     * @brief Stops a timer.
+     *
+     * @param entry Timer to stop.
+     * @return true if the timer has been stopped.
+     */
+    bool_t stop(Entry& entry);
+
+    /**
+     * @brief Advances the wheel by one tick and calls handlers of expired timers.
+     */
+    void tick();
+
+    /**
+     * @brief Returns current time of the wheel.
+     *
+     * @return Ticks passed from the wheel construction.
+     */
+    uint32_t getTime() const;
+
+private:
+
+    /**
+     * @brief Number of wheel levels.
+     */
+    static const int32_t LEVELS = 4;
+
+    /**
+     * @brief Number of bits of slot index.
+     */
+    static const int32_t SLOT_BITS = 5;
+
+    /**
+     * @brief Number of slots of a level.
+     */
+    static const int32_t SLOTS = 1 << SLOT_BITS;
+
+    /**
+     * @brief Mask of slot index.
+     */
+    static const uint32_t SLOT_MASK = static_cast<uint32_t>(SLOTS - 1);
+
+    /**
+     * @brief Inserts a timer to a slot by its expiration.
+     *
+     * @param entry Timer to insert.
+     */
+    void insert(Entry& entry);
+
+    /**
+     * @brief Moves timers of a slot of a level to lower levels.
+     *
+     * @param level Level of the slot.
+     */
+    void cascade(int32_t level);
+
+    /**
+     * @brief Initializes a list.
+     *
+     * @param list Head of the list.
+     */
+    static void initialize(Node& list);
+
+    /**
+     * @brief Links a node to the end of a list.
+     *
+     * @param list Head of the list.
+     * @param node Node to link.
+     */
+    static void link(Node& list, Node& node);
+
+    /**
+     * @brief Unlinks a node from its list.
+     *
+     * @param node Node to unlink.
+     */
+    static void unlink(Node& node);
+
+    /**
+     * @brief Moves all nodes of a list to other list.
+     *
+     * @param from Head of the list to move from.
+     * @param to   Head of the empty list to move to.
+     */
+    static void move(Node& from, Node& to);
+
+    /**
+     * @brief Slots of the wheel levels.
+     */
+    Node slots_[LEVELS][SLOTS];
+
+    /**
+     * @brief Current time of the wheel in ticks.
+     */
+    uint32_t time_;
+
+};
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_TIMERWHEEL_HPP_
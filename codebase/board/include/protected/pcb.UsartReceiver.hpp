@@ -0,0 +1,197 @@
+/**
+ * @file      pcb.UsartReceiver.hpp
+ * @brief     EOOS line receiver of a USART
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_USARTRECEIVER_HPP_
+#define PCB_USARTRECEIVER_HPP_
+
+#include "lib.NonCopyable.hpp"
+#include "lib.NoAllocator.hpp"
+#include "pcb.Notifier.hpp"
+#include "pcb.Nvic.hpp"
+#include "pcb.Ramfunc.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @class UsartReceiver
+ * @brief Receiver of text lines from a USART which is configured by the USART driver for transmission.
+ *
+ * The receiver is enabled on the constructor call, and the serial line configuration
+ * of the driver is kept. A reading thread is blocked until the receive interrupt
+ * notifies it of a character, so lines are received only while a read is in progress,
+ * which suits commands entered to a debug terminal.
+ *
+ * @note RX pin of the USART is expected in its reset state of the floating input.
+ *       The interrupt request of the USART is owned by the receiver while it exists,
+ *       so only one receiver of a USART can exist. The handler, the priority and the
+ *       enabling of the request are restored on the destructor call, and the previous
+ *       handler is called for each interrupt if the request was enabled before, so that
+ *       the driver keeps its transmission interrupts. The driver must not take the
+ *       receive interrupt then, which is enabled by the receiver only.
+ */
+class UsartReceiver : public lib::NonCopyable<lib::NoAllocator>
+{
+
+public:
+
+    /**
+     * @enum Number
+     * @brief USART numbers of the MCU.
+     */
+    enum Number
+    {
+        NUMBER_USART1 = 0,
+        NUMBER_USART2 = 1,
+        NUMBER_USART3 = 2
+    };
+
+    /**
+     * @brief Infinite timeout of waiting.
+     */
+    static const int32_t TIMEOUT_INFINITE = -1;
+
+    /**
+     * @brief Constructor.
+     *
+     * As a thread has one notification value, the receiver takes a notifier, which the
+     * reading thread is already bound to, instead of binding the thread to one more notifier.
+     *
+     * @param number   USART number.
+     * @param notifier Notifier of the thread which reads lines.
+     */
+    UsartReceiver(Number number, Notifier& notifier);
+
+    /**
+     * @brief Destructor.
+     *
+     * The receiver is disabled if it was disabled before the constructor call.
+     */
+    virtual ~UsartReceiver();
+
+    /**
+     * @brief Reads a line terminated by CR or LF.
+     *
+     * An empty line is not returned if the terminator of the previous line
+     * is CR LF. Characters which exceed the buffer are lost. The function must be
+     * called by the thread bound to the notifier, and a pending notification
+     * of the notifier is dropped on return.
+     *
+     * @param line    Buffer for the line, which is terminated by zero.
+     * @param size    Size of the buffer in characters.
+     * @param timeout Timeout in milliseconds, or TIMEOUT_INFINITE.
+     * @return Number of characters of the line, or -1 if the timeout expires before the line terminator or an error has been occurred.
+     */
+    int32_t readLine(char_t* line, int32_t size, int32_t timeout);
+
+private:
+
+    /**
+     * @struct Registers
+     * @brief USART registers.
+     */
+    struct Registers
+    {
+        uint32_t volatile sr;   ///< Status register.
+        uint32_t volatile dr;   ///< Data register.
+        uint32_t volatile brr;  ///< Baud rate register.
+        uint32_t volatile cr1;  ///< Control register 1.
+    };
+
+    /**
+     * @brief Number of USARTs of the MCU.
+     */
+    static const int32_t NUMBER_OF_USARTS = 3;
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return true if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Enables the receive interrupt, or disables it.
+     *
+     * @param isEnabled Enables the interrupt.
+     */
+    void setInterrupt(bool_t isEnabled);
+
+    /**
+     * @brief Handles an interrupt of a USART.
+     *
+     * @param number USART number.
+     */
+    EOOS_PCB_RAMFUNC static void handle(int32_t number);
+
+    /**
+     * @brief Handles USART1 interrupt.
+     */
+    EOOS_PCB_RAMFUNC static void handleUsart1();
+
+    /**
+     * @brief Handles USART2 interrupt.
+     */
+    EOOS_PCB_RAMFUNC static void handleUsart2();
+
+    /**
+     * @brief Handles USART3 interrupt.
+     */
+    EOOS_PCB_RAMFUNC static void handleUsart3();
+
+    /**
+     * @brief Receivers of USARTs.
+     */
+    static UsartReceiver* receivers_[NUMBER_OF_USARTS];
+
+    /**
+     * @brief USART number.
+     */
+    Number number_;
+
+    /**
+     * @brief USART registers.
+     */
+    Registers& reg_;
+
+    /**
+     * @brief Notifier of the reading thread.
+     */
+    Notifier& notifier_;
+
+    /**
+     * @brief Handler of the interrupt request before the constructor call.
+     */
+    Nvic::Handler handler_;
+
+    /**
+     * @brief Priority of the interrupt request before the constructor call.
+     */
+    uint32_t priority_;
+
+    /**
+     * @brief Interrupt request was enabled before the constructor call.
+     */
+    bool_t isIrqEnabled_;
+
+    /**
+     * @brief Receiver was enabled before the constructor call.
+     */
+    bool_t isEnabled_;
+
+    /**
+     * @brief Last received character was CR.
+     */
+    bool_t isCarriageReturn_;
+
+};
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_USARTRECEIVER_HPP_
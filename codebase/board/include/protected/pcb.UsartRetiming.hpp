@@ -0,0 +1,104 @@
+/**
+ * @file      pcb.UsartRetiming.hpp
+ * @brief     EOOS USART baud rate retiming on clock changes
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_USARTRETIMING_HPP_
+#define PCB_USARTRETIMING_HPP_
+
+#include "pcb.ClockListener.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @class UsartRetiming
+ * @brief Listener which keeps the baud rate of a USART on clock changes.
+ *
+ * The baud rate is taken from BRR register and the current clock before the change,
+ * so the USART driver configuration is kept and the listener does not need to know it.
+ */
+class UsartRetiming : public ClockListener
+{
+
+public:
+
+    /**
+     * @enum Number
+     * @brief USART numbers of the MCU.
+     */
+    enum Number
+    {
+        NUMBER_USART1 = 0,
+        NUMBER_USART2 = 1,
+        NUMBER_USART3 = 2
+    };
+
+    /**
+     * @brief Constructor.
+     *
+     * @param number USART number.
+     */
+    explicit UsartRetiming(Number number);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~UsartRetiming();
+
+    /**
+     * @copydoc eoos::pcb::ClockListener::suspend(ClockFrequencies const&, ClockFrequencies const&)
+     */
+    virtual bool_t suspend(ClockFrequencies const& current, ClockFrequencies const& next);
+
+    /**
+     * @copydoc eoos::pcb::ClockListener::resume(ClockFrequencies const&)
+     */
+    virtual void resume(ClockFrequencies const& frequencies);
+
+private:
+
+    /**
+     * @struct Registers
+     * @brief USART registers.
+     */
+    struct Registers
+    {
+        uint32_t volatile sr;   ///< Status register.
+        uint32_t volatile dr;   ///< Data register.
+        uint32_t volatile brr;  ///< Baud rate register.
+        uint32_t volatile cr1;  ///< Control register 1.
+    };
+
+    /**
+     * @brief Returns frequency of the bus of the USART.
+     *
+     * @param frequencies Frequencies of the bus clocks.
+     * @return Frequency in Hz.
+     */
+    uint32_t getClock(ClockFrequencies const& frequencies) const;
+
+    /**
+     * @brief USART number.
+     */
+    Number number_;
+
+    /**
+     * @brief USART registers.
+     */
+    Registers& reg_;
+
+    /**
+     * @brief Baud rate, or zero if the USART is disabled.
+     */
+    uint32_t baud_;
+
+};
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_USARTRETIMING_HPP_
@@ -0,0 +1,295 @@
+/**
+ * @file      pcb.Waveform.hpp
+ * @brief     EOOS DMA driven GPIO waveform
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_WAVEFORM_HPP_
+#define PCB_WAVEFORM_HPP_
+
+#include "lib.NonCopyable.hpp"
+#include "lib.NoAllocator.hpp"
+#include "pcb.ClockListener.hpp"
+#include "pcb.GpioPort.hpp"
+#include "pcb.Notifier.hpp"
+#include "pcb.Ramfunc.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @class Waveform
+ * @brief Generator of GPIO waveforms by TIM2 update DMA requests.
+ *
+ * Each update event of TIM2 requests DMA1 channel 2 to write the next word of a buffer
+ * to BSRR register of a port, so that the pins are switched at the sample rate
+ * without any CPU involvement. A buffer is written once, or is written continuously
+ * in the circular mode, in which a source refills the half of the buffer
+ * which has just been written while DMA writes the other half.
+ *
+ * The object listens to the clock changes of the clock scaler, and it retimes TIM2
+ * to keep the sample rate, or rejects a clock at which the rate cannot be generated.
+ *
+ * @note TIM2 and DMA1 channel 2 are owned by the object, therefore only one object can exist.
+ */
+class Waveform : public lib::NonCopyable<lib::NoAllocator>, public ClockListener
+{
+
+public:
+
+    /**
+     * @class Source
+     * @brief Source of waveform words for the continuous generation.
+     */
+    class Source
+    {
+
+    public:
+
+        /**
+         * @brief Destructor.
+         */
+        virtual ~Source() = 0;
+
+        /**
+         * @brief Fills a half of the buffer which has been written.
+         *
+         * The function is called by the DMA interrupt service routine and
+         * must complete before DMA finishes writing the other half of the buffer.
+         *
+         * @param words  Words to be filled.
+         * @param length Number of words.
+         */
+        virtual void fill(uint32_t* words, int32_t length) = 0;
+
+    };
+
+    /**
+     * @struct Config
+     * @brief Waveform configuration.
+     */
+    struct Config
+    {
+        GpioPort::Number port; ///< Port of the pins.
+        uint32_t mask;         ///< Pins to be configured as push-pull outputs.
+        int32_t rate;          ///< Sample rate in words per second.
+    };
+
+    /**
+     * @brief Divider of TIM2 clock to the maximum sample rate.
+     *
+     * A word is transferred by DMA to APB2 bus in a few cycles, but
+     * the bus is shared with the CPU and other channels.
+     */
+    static const int32_t RATE_DIVIDER = 8;
+
+    /**
+     * @brief Maximum sample rate in words per second, which is of TIM2 clock of 72 MHz.
+     */
+    static const int32_t MAXIMUM_RATE = 72000000 / RATE_DIVIDER;
+
+    /**
+     * @brief Maximum number of words of a buffer.
+     */
+    static const int32_t MAXIMUM_LENGTH = 0xFFFF;
+
+    /**
+     * @brief Infinite timeout of waiting.
+     */
+    static const int32_t TIMEOUT_INFINITE = Notifier::TIMEOUT_INFINITE;
+
+    /**
+     * @brief Constructor.
+     *
+     * The constructor must be called by the thread, which will wait for the end of writing.
+     *
+     * @param config Waveform configuration.
+     */
+    explicit Waveform(Config const& config);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~Waveform();
+
+    /**
+     * @copydoc eoos::pcb::ClockListener::suspend(ClockFrequencies const&, ClockFrequencies const&)
+     */
+    virtual bool_t suspend(ClockFrequencies const& current, ClockFrequencies const& next);
+
+    /**
+     * @copydoc eoos::pcb::ClockListener::resume(ClockFrequencies const&)
+     */
+    virtual void resume(ClockFrequencies const& frequencies);
+
+    /**
+     * @brief Writes a buffer once.
+     *
+     * @param words  Words to be written to BSRR register, which must exist until the end of writing.
+     * @param length Number of words.
+     * @return true if writing has been started.
+     */
+    bool_t write(uint32_t const* words, int32_t length);
+
+    /**
+     * @brief Writes a buffer continuously.
+     *
+     * @param words  Words to be written to BSRR register, which must exist until the generation is stopped.
+     * @param length Even number of words.
+     * @param source Source to refill halves of the buffer, or NULLPTR to repeat the buffer.
+     * @return true if generation has been started.
+     */
+    bool_t start(uint32_t* words, int32_t length, Source* source);
+
+    /**
+     * @brief Stops writing.
+     */
+    void stop();
+
+    /**
+     * @brief Waits for the end of writing a buffer once.
+     *
+     * The function must be called by the thread which has constructed the object.
+     *
+     * @param timeout Timeout in milliseconds, or TIMEOUT_INFINITE.
+     * @return true if writing has been completed.
+     */
+    bool_t wait(int32_t timeout);
+
+    /**
+     * @brief Tests if writing is active.
+     *
+     * @return true if active.
+     */
+    bool_t isActive() const;
+
+    /**
+     * @brief Returns the sample rate set.
+     *
+     * The rate is the nearest rate the timer is able to generate.
+     *
+     * @return Words per second.
+     */
+    int32_t getRate() const;
+
+    /**
+     * @brief Returns number of halves which have not been refilled in time.
+     *
+     * @return Number of halves.
+     */
+    uint32_t getUnderruns() const;
+
+    /**
+     * @brief Returns BSRR word to set pins to a value.
+     *
+     * @param mask  Pins to be written.
+     * @param value Value of the pins.
+     * @return BSRR word.
+     */
+    static uint32_t getWord(uint32_t const mask, uint32_t const value)
+    {
+        return (mask & value) | ((mask & ~value) << 16);
+    }
+
+private:
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @param config Waveform configuration.
+     * @return true if object has been constructed successfully.
+     */
+    bool_t construct(Config const& config);
+
+    /**
+     * @brief Starts writing.
+     *
+     * @param words  Words to be written.
+     * @param length Number of words.
+     * @param circular Writes the buffer continuously.
+     * @return true if writing has been started.
+     */
+    bool_t run(uint32_t const* words, int32_t length, bool_t circular);
+
+    /**
+     * @brief Calculates TIM2 prescaler and auto-reload value for the sample rate.
+     *
+     * @param clock TIM2 clock in Hz.
+     */
+    void setTiming(uint32_t clock);
+
+    /**
+     * @brief Handles DMA1 channel 2 interrupt.
+     */
+    EOOS_PCB_RAMFUNC static void handleDma();
+
+    /**
+     * @brief The object owning TIM2 and DMA1 channel 2.
+     */
+    static Waveform* waveform_;
+
+    /**
+     * @brief Port of the pins.
+     */
+    GpioPort port_;
+
+    /**
+     * @brief Sample rate requested in words per second.
+     */
+    int32_t rate_;
+
+    /**
+     * @brief TIM2 clock in Hz.
+     */
+    uint32_t clock_;
+
+    /**
+     * @brief TIM2 prescaler.
+     */
+    uint32_t prescaler_;
+
+    /**
+     * @brief TIM2 auto-reload value.
+     */
+    uint32_t reload_;
+
+    /**
+     * @brief Notifier of the end of writing.
+     */
+    Notifier notifier_;
+
+    /**
+     * @brief Buffer written continuously.
+     */
+    uint32_t* words_;
+
+    /**
+     * @brief Number of words of the buffer written continuously.
+     */
+    int32_t length_;
+
+    /**
+     * @brief Source to refill halves of the buffer.
+     */
+    Source* source_;
+
+    /**
+     * @brief Writing is active.
+     */
+    bool_t volatile isActive_;
+
+    /**
+     * @brief Number of halves which have not been refilled in time.
+     */
+    uint32_t volatile underruns_;
+
+};
+
+inline Waveform::Source::~Source() {}
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_WAVEFORM_HPP_
@@ -0,0 +1,34 @@
+/**
+ * @file      pcb.ZeroLatencyGuard.hpp
+ * @brief     EOOS compile-time guard of zero-latency interrupt handlers
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * The header is included after all the other headers by a translation unit
+ * of zero-latency interrupt handlers, and makes any further use of the kernel
+ * functions and the board functions calling the kernel from interrupts a compile error.
+ * The macros of the kernel API are poisoned as well, since a poisoned function
+ * is not caught in expansion of a macro defined before. The header has no
+ * include guard, as it does not declare anything.
+ */
+#if defined(__GNUC__)
+
+// Suppress warnings of poisoning the existing macros
+#pragma GCC system_header
+
+#pragma GCC poison xQueueGenericSendFromISR xQueueGiveFromISR xQueueReceiveFromISR
+#pragma GCC poison xQueueIsQueueEmptyFromISR xQueueIsQueueFullFromISR uxQueueMessagesWaitingFromISR
+#pragma GCC poison xQueueSendFromISR xQueueSendToBackFromISR xQueueSendToFrontFromISR xQueueOverwriteFromISR
+#pragma GCC poison xSemaphoreGiveFromISR xSemaphoreTakeFromISR
+#pragma GCC poison xTaskGenericNotifyFromISR vTaskGenericNotifyGiveFromISR vTaskNotifyGiveFromISR
+#pragma GCC poison xTaskNotifyFromISR xTaskNotifyAndQueryFromISR
+#pragma GCC poison xTaskResumeFromISR xTaskGetTickCountFromISR xTimerPendFunctionCallFromISR
+#pragma GCC poison xTimerGenericCommand xTimerStartFromISR xTimerStopFromISR xTimerResetFromISR xTimerChangePeriodFromISR
+#pragma GCC poison xEventGroupSetBitsFromISR xEventGroupClearBitsFromISR
+#pragma GCC poison taskENTER_CRITICAL taskEXIT_CRITICAL taskENTER_CRITICAL_FROM_ISR taskEXIT_CRITICAL_FROM_ISR
+#pragma GCC poison vPortEnterCritical vPortExitCritical vTaskSuspendAll xTaskResumeAll
+#pragma GCC poison portYIELD_FROM_ISR portEND_SWITCHING_ISR
+#pragma GCC poison notifyFromInterrupt setBitsFromInterrupt raiseFromInterrupt
+#pragma GCC poison startFromInterrupt stopFromInterrupt
+
+#endif // __GNUC__
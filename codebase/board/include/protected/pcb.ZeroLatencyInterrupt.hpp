@@ -0,0 +1,71 @@
+/**
+ * @file      pcb.ZeroLatencyInterrupt.hpp
+ * @brief     EOOS interrupt of the zero-latency priority class
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_ZEROLATENCYINTERRUPT_HPP_
+#define PCB_ZEROLATENCYINTERRUPT_HPP_
+
+#include "pcb.StaticInterrupt.hpp"
+#include "FreeRTOS.h"
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @class ZeroLatencyInterrupt<IRQ,HANDLER,PRIORITY>
+ * @brief Interrupt request of the zero-latency priority class.
+ *
+ * The priority of the interrupt is above configMAX_SYSCALL_INTERRUPT_PRIORITY,
+ * therefore it is masked neither by kernel critical sections nor by pcb::CriticalSection,
+ * and its latency does not depend on the kernel. In return, the handler must not
+ * call any kernel function including the FromISR ones, as it can interrupt
+ * the kernel in an inconsistent state. To check that at compile time,
+ * the handler is to be defined in a translation unit, which includes
+ * pcb.ZeroLatencyGuard.hpp after all the other headers.
+ *
+ * @tparam IRQ      Interrupt request number.
+ * @tparam HANDLER  Handler function.
+ * @tparam PRIORITY Priority value of IPR register above the kernel priorities.
+ */
+template <int32_t IRQ, Nvic::Handler HANDLER, uint32_t PRIORITY = 0x00U>
+class ZeroLatencyInterrupt : public StaticInterrupt<IRQ, HANDLER>
+{
+    typedef StaticInterrupt<IRQ, HANDLER> Parent;
+
+    /**
+     * @brief Compile-time check of the priority to be above the kernel priorities.
+     */
+    typedef char PriorityCheck[ (PRIORITY < static_cast<uint32_t>(configMAX_SYSCALL_INTERRUPT_PRIORITY)) ? 1 : -1 ];
+
+public:
+
+    /**
+     * @brief Puts the handler to the interrupt vector and sets the zero-latency priority.
+     *
+     * @return true if the handler has been set.
+     */
+    static bool_t bind()
+    {
+        Parent::setPriority(PRIORITY);
+        return Parent::bind();
+    }
+
+private:
+
+    /**
+     * @brief Setting another priority is not allowed.
+     *
+     * @param priority Priority value of IPR register.
+     */
+    static void setPriority(uint32_t priority);
+
+};
+
+} // namespace pcb
+} // namespace eoos
+
+#endif // PCB_ZEROLATENCYINTERRUPT_HPP_
@@ -0,0 +1,187 @@
+/**
+ * @file      pcb.AbstractCanHealth.cpp
+ * @brief     EOOS abstract CAN controller health monitor
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "pcb.AbstractCanHealth.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+AbstractCanHealth::AbstractCanHealth(Policy const& policy, EventGroup* const events)
+    : lib::NonCopyable<lib::NoAllocator>()
+    , Handler()
+    , policy_( policy )
+    , events_( events )
+    , status_()
+    , offTime_( 0 )
+    , onTime_( 0 ) {
+    bool_t const isConstructed( construct(policy) );
+    setConstructed( isConstructed );
+}
+
+AbstractCanHealth::~AbstractCanHealth()
+{
+}
+
+bool_t AbstractCanHealth::getStatus(Status* const status) const
+{
+    bool_t res( false );
+    if( isConstructed() && (status != NULLPTR) )
+    {
+        UBaseType_t const mask( portSET_INTERRUPT_MASK_FROM_ISR() );
+        *status = status_;
+        portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+        res = true;
+    }
+    return res;
+}
+
+void AbstractCanHealth::update()
+{
+    update(false);
+}
+
+void AbstractCanHealth::updateFromInterrupt()
+{
+    update(true);
+}
+
+bool_t AbstractCanHealth::recover()
+{
+    bool_t res( false );
+    if( isConstructed() && (status_.state == STATE_BUS_OFF) )
+    {
+        restart();
+        res = true;
+    }
+    return res;
+}
+
+void AbstractCanHealth::handle()
+{
+    if( isConstructed() )
+    {
+        update(false);
+        if( status_.state == STATE_BUS_OFF )
+        {
+            onTime_ = 0;
+            if( (policy_.recovery == RECOVERY_AUTOMATIC) && (offTime_ >= status_.delay) )
+            {
+                restart();
+                offTime_ = 0;
+                status_.delay = (status_.delay < policy_.maximumDelay / 2) ? (status_.delay * 2) : policy_.maximumDelay;
+            }
+            offTime_ += policy_.period;
+        }
+        else
+        {
+            offTime_ = 0;
+            if( onTime_ < policy_.stableTime )
+            {
+                onTime_ += policy_.period;
+            }
+            else
+            {
+                status_.delay = policy_.initialDelay;
+            }
+        }
+    }
+}
+
+bool_t AbstractCanHealth::construct(Policy const& policy)
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {
+            break;
+        }
+        if( (policy.period <= 0) || (policy.initialDelay < policy.period) || (policy.maximumDelay < policy.initialDelay) || (policy.stableTime < 0) )
+        {
+            break;
+        }
+        status_.state = STATE_ERROR_ACTIVE;
+        status_.delay = policy.initialDelay;
+        onTime_ = policy.stableTime;
+        res = true;
+    } while(false);
+    return res;
+}
+
+void AbstractCanHealth::update(bool_t const isInterrupt)
+{
+    if( isConstructed() )
+    {
+        Sample sample = { 0 };
+        uint32_t events( 0U );
+        UBaseType_t const mask( portSET_INTERRUPT_MASK_FROM_ISR() );
+        this->sample(&sample);
+        State const state( sample.isBusOff ? STATE_BUS_OFF
+                         : sample.isPassive ? STATE_ERROR_PASSIVE
+                         : sample.isWarning ? STATE_ERROR_WARNING : STATE_ERROR_ACTIVE );
+        status_.tec = sample.tec;
+        status_.rec = sample.rec;
+        status_.errors += sample.errors;
+        status_.lostArbitrations += sample.lostArbitrations;
+        status_.overruns += sample.overruns;
+        if( state != status_.state )
+        {
+            if( status_.state == STATE_BUS_OFF )
+            {
+                status_.recoveries++;
+                events |= EVENT_RECOVERED;
+            }
+            switch( state )
+            {
+                case STATE_ERROR_WARNING:
+                {
+                    status_.warnings++;
+                    events |= EVENT_ERROR_WARNING;
+                    break;
+                }
+                case STATE_ERROR_PASSIVE:
+                {
+                    status_.errorPassives++;
+                    events |= EVENT_ERROR_PASSIVE;
+                    break;
+                }
+                case STATE_BUS_OFF:
+                {
+                    status_.busOffs++;
+                    events |= EVENT_BUS_OFF;
+                    break;
+                }
+                default:
+                {
+                    events |= EVENT_ERROR_ACTIVE;
+                    break;
+                }
+            }
+            status_.state = state;
+        }
+        if( sample.overruns != 0U )
+        {
+            events |= EVENT_OVERRUN;
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+        if( (events != 0U) && (events_ != NULLPTR) )
+        {
+            if( isInterrupt )
+            {
+                static_cast<void>( events_->setBitsFromInterrupt(events) );
+            }
+            else
+            {
+                static_cast<void>( events_->setBits(events) );
+            }
+        }
+    }
+}
+
+} // namespace pcb
+} // namespace eoos
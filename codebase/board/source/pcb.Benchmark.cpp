@@ -0,0 +1,209 @@
+/**
+ * @file      pcb.Benchmark.cpp
+ * @brief     EOOS microbenchmark
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "pcb.Benchmark.hpp"
+#include "pcb.CycleCounter.hpp"
+#include "pcb.Formatter.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+namespace
+{
+
+/**
+ * @brief Number of readings to measure the counter overhead.
+ */
+const int32_t CALIBRATION_READINGS( 16 );
+
+/**
+ * @brief Returns the integer square root.
+ *
+ * @param value Value.
+ * @return The largest integer which square is not greater than the value.
+ */
+uint32_t getSquareRoot(uint64_t value)
+{
+    uint64_t root( 0U );
+    uint64_t bit( static_cast<uint64_t>(1U) << 62 );
+    while( bit > value )
+    {
+        bit >>= 2;
+    }
+    while( bit != 0U )
+    {
+        if( value >= root + bit )
+        {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return static_cast<uint32_t>(root);
+}
+
+} // namespace
+
+Benchmark::Benchmark(Config const& config)
+    : lib::NonCopyable<lib::NoAllocator>()
+    , config_( config )
+    , result_()
+    , samples_( config.samples ) {
+    bool_t const isConstructed( construct(config) );
+    setConstructed( isConstructed );
+}
+
+Benchmark::~Benchmark()
+{
+}
+
+bool_t Benchmark::run(Task& task)
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {
+            break;
+        }
+        Counter const counter( config_.counter );
+        for(int32_t i(0); i<config_.warmup; i++)
+        {
+            task.run();
+        }
+        uint32_t const overhead( calibrate() );
+        uint32_t const start( counter() );
+        int32_t number( 0 );
+        while( number < config_.iterations )
+        {
+            uint32_t const begin( counter() );
+            task.run();
+            uint32_t const ticks( counter() - begin );
+            samples_[number] = (ticks > overhead) ? (ticks - overhead) : 0U;
+            number++;
+            if( (config_.mode == MODE_TIME) && ((counter() - start) >= config_.time) )
+            {
+                break;
+            }
+        }
+        summarize(number);
+        res = true;
+    } while(false);
+    return res;
+}
+
+Benchmark::Result const& Benchmark::getResult() const
+{
+    return result_;
+}
+
+void Benchmark::print(api::OutStream<char_t>& stream) const
+{
+    Formatter formatter(stream);
+    formatter << "# BENCH name=" << config_.name
+              << " n=" << result_.samples
+              << " min=" << result_.min
+              << " median=" << result_.median
+              << " p99=" << result_.p99
+              << " max=" << result_.max
+              << " mean=" << result_.mean
+              << " stddev=" << result_.stddev
+              << " unit=cycles\r\n";
+}
+
+bool_t Benchmark::construct(Config const& config)
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {
+            break;
+        }
+        if( (config.name == NULLPTR) || (config.samples == NULLPTR) )
+        {
+            break;
+        }
+        if( (config.warmup < 0) || (config.iterations <= 0) || (config.iterations > MAXIMUM_SAMPLES) )
+        {
+            break;
+        }
+        if( (config.mode == MODE_TIME) && (config.time == 0U) )
+        {
+            break;
+        }
+        if( config.counter == NULLPTR )
+        {
+            config_.counter = &Benchmark::getCycles;
+        }
+        res = true;
+    } while(false);
+    return res;
+}
+
+uint32_t Benchmark::calibrate() const
+{
+    Counter const counter( config_.counter );
+    uint32_t overhead( 0xFFFFFFFFU );
+    for(int32_t i(0); i<CALIBRATION_READINGS; i++)
+    {
+        uint32_t const begin( counter() );
+        uint32_t const ticks( counter() - begin );
+        overhead = (ticks < overhead) ? ticks : overhead;
+    }
+    return overhead;
+}
+
+void Benchmark::summarize(int32_t const number)
+{
+    // Insertion sort, as the number of samples is small and the samples are often nearly sorted
+    for(int32_t i(1); i<number; i++)
+    {
+        uint32_t const sample( samples_[i] );
+        int32_t j( i - 1 );
+        while( (j >= 0) && (samples_[j] > sample) )
+        {
+            samples_[j + 1] = samples_[j];
+            j--;
+        }
+        samples_[j + 1] = sample;
+    }
+    uint64_t sum( 0U );
+    for(int32_t i(0); i<number; i++)
+    {
+        sum += samples_[i];
+    }
+    uint32_t const mean( static_cast<uint32_t>( sum / static_cast<uint64_t>(number) ) );
+    uint64_t variance( 0U );
+    for(int32_t i(0); i<number; i++)
+    {
+        int64_t const deviation( static_cast<int64_t>(samples_[i]) - static_cast<int64_t>(mean) );
+        variance += static_cast<uint64_t>(deviation * deviation);
+    }
+    variance /= static_cast<uint64_t>(number);
+    // The percentile is of the nearest rank
+    int32_t const rank( (number * 99 + 99) / 100 );
+    result_.samples = number;
+    result_.min = samples_[0];
+    result_.median = samples_[number / 2];
+    result_.p99 = samples_[rank - 1];
+    result_.max = samples_[number - 1];
+    result_.mean = mean;
+    result_.stddev = getSquareRoot(variance);
+}
+
+uint32_t Benchmark::getCycles()
+{
+    return CycleCounter::get();
+}
+
+} // namespace pcb
+} // namespace eoos
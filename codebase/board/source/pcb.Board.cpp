@@ -14,7 +14,10 @@ namespace pcb
     
 Board::Board()
     : lib::NonCopyable<lib::NoAllocator>()
-    , usart_() {     
+    , usart_()
+    , clock_()
+    , scaler_()
+    , usartRetiming_( UsartRetiming::NUMBER_USART1 ) {     
     bool_t const isConstructed( construct() );
     setConstructed( isConstructed );
 }
@@ -37,6 +40,22 @@ bool_t Board::construct()
         {
             break;
         }
+        if( !clock_.isConstructed() )
+        {
+            break;
+        }
+        if( !scaler_.isConstructed() )
+        {
+            break;
+        }
+        if( !scaler_.addListener(clock_) )
+        {
+            break;
+        }
+        if( !scaler_.addListener(usartRetiming_) )
+        {
+            break;
+        }
         res = true;
     } while(false);
     return res;
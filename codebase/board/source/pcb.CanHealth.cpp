@@ -0,0 +1,173 @@
+/**
+ * @file      pcb.CanHealth.cpp
+ * @brief     EOOS CAN1 controller health monitor
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "pcb.CanHealth.hpp"
+#include "pcb.Nvic.hpp"
+#include "pcb.Register.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+namespace
+{
+
+typedef Peripheral<0x40006400U> Can1; ///< CAN1 controller.
+
+typedef Register<Can1, 0x00U> CanMcr;                           ///< Master control register.
+typedef Register<Can1, 0x04U, REGISTER_ACCESS_RC_W1> CanMsr;    ///< Master status register.
+typedef Register<Can1, 0x08U, REGISTER_ACCESS_RO> CanTsr;       ///< Transmit status register.
+typedef Register<Can1, 0x0CU, REGISTER_ACCESS_RC_W1> CanRf0r;   ///< Receive FIFO 0 register.
+typedef Register<Can1, 0x10U, REGISTER_ACCESS_RC_W1> CanRf1r;   ///< Receive FIFO 1 register.
+typedef Register<Can1, 0x14U> CanIer;                           ///< Interrupt enable register.
+typedef Register<Can1, 0x18U> CanEsr;                           ///< Error status register.
+
+typedef RegisterField<CanMcr, 0U> CanMcrInrq;                   ///< Initialization request.
+typedef RegisterField<CanMcr, 6U> CanMcrAbom;                   ///< Automatic bus-off management.
+typedef RegisterField<CanMsr, 0U> CanMsrInak;                   ///< Initialization acknowledge.
+typedef RegisterField<CanMsr, 2U> CanMsrErri;                   ///< Error interrupt.
+typedef RegisterField<CanRf0r, 4U> CanRf0rFovr0;                ///< FIFO 0 overrun.
+typedef RegisterField<CanRf1r, 4U> CanRf1rFovr1;                ///< FIFO 1 overrun.
+typedef RegisterField<CanIer, 8U> CanIerEwgie;                  ///< Error warning interrupt enable.
+typedef RegisterField<CanIer, 9U> CanIerEpvie;                  ///< Error passive interrupt enable.
+typedef RegisterField<CanIer, 10U> CanIerBofie;                 ///< Bus-off interrupt enable.
+typedef RegisterField<CanIer, 15U> CanIerErrie;                 ///< Error interrupt enable.
+typedef RegisterField<CanEsr, 0U> CanEsrEwgf;                   ///< Error warning flag.
+typedef RegisterField<CanEsr, 1U> CanEsrEpvf;                   ///< Error passive flag.
+typedef RegisterField<CanEsr, 2U> CanEsrBoff;                   ///< Bus-off flag.
+typedef RegisterField<CanEsr, 4U, 3U> CanEsrLec;                ///< Last error code.
+typedef RegisterField<CanEsr, 16U, 8U> CanEsrTec;               ///< Transmit error counter.
+typedef RegisterField<CanEsr, 24U, 8U> CanEsrRec;               ///< Receive error counter.
+
+const uint32_t LEC_NO_ERROR( 0U );      ///< No error.
+const uint32_t LEC_SOFTWARE( 7U );      ///< Code set by software to detect a next error.
+const uint32_t TSR_ALST( 0x00040404U ); ///< Arbitration lost flags of mailboxes 0, 1 and 2.
+
+/**
+ * @brief Number of polls of a status flag.
+ */
+const int32_t STATUS_POLLS( 100000 );
+
+} // namespace
+
+CanHealth* CanHealth::health_( NULLPTR );
+
+CanHealth::CanHealth(Policy const& policy, EventGroup* const events)
+    : AbstractCanHealth(policy, events)
+    , arbitrations_( 0U )
+    , isAbom_( false ) {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+CanHealth::~CanHealth()
+{
+    if( health_ == this )
+    {
+        static_cast<void>( Nvic::disable(Nvic::IRQ_CAN1_SCE) );
+        CanIer::modify( CanIerEwgie::clear() | CanIerEpvie::clear() | CanIerBofie::clear() | CanIerErrie::clear() );
+        if( isAbom_ )
+        {
+            CanMcr::modify( CanMcrAbom::set() );
+        }
+        health_ = NULLPTR;
+    }
+}
+
+void CanHealth::sample(Sample* const sample)
+{
+    uint32_t const esr( CanEsr::read() );
+    sample->tec = (esr & CanEsrTec::MASK) >> 16;
+    sample->rec = (esr & CanEsrRec::MASK) >> 24;
+    sample->isWarning = CanEsrEwgf::isSet(esr);
+    sample->isPassive = CanEsrEpvf::isSet(esr);
+    sample->isBusOff = CanEsrBoff::isSet(esr);
+    uint32_t const lec( (esr & CanEsrLec::MASK) >> 4 );
+    if( lec != LEC_SOFTWARE )
+    {
+        // The code is set to the value, which the controller never sets, to see a next error
+        CanEsr::write( CanEsrLec::value(LEC_SOFTWARE) );
+    }
+    sample->errors = ( (lec != LEC_NO_ERROR) && (lec != LEC_SOFTWARE) ) ? 1U : 0U;
+    uint32_t const arbitrations( CanTsr::read() & TSR_ALST );
+    uint32_t lost( arbitrations & ~arbitrations_ );
+    arbitrations_ = arbitrations;
+    sample->lostArbitrations = 0U;
+    while( lost != 0U )
+    {
+        lost &= lost - 1U;
+        sample->lostArbitrations++;
+    }
+    sample->overruns = 0U;
+    if( CanRf0rFovr0::read() != 0U )
+    {
+        CanRf0r::write( CanRf0rFovr0::set() );
+        sample->overruns++;
+    }
+    if( CanRf1rFovr1::read() != 0U )
+    {
+        CanRf1r::write( CanRf1rFovr1::set() );
+        sample->overruns++;
+    }
+}
+
+void CanHealth::restart()
+{
+    // The controller leaves bus-off after 128 occurrences of 11 recessive bits,
+    // which it starts to wait for on leaving the initialization mode
+    CanMcr::modify( CanMcrInrq::set() );
+    int32_t polls( STATUS_POLLS );
+    while( (CanMsrInak::read() == 0U) && (polls > 0) )
+    {
+        polls--;
+    }
+    CanMcr::modify( CanMcrInrq::clear() );
+}
+
+bool_t CanHealth::construct()
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {
+            break;
+        }
+        if( health_ != NULLPTR )
+        {
+            break;
+        }
+        health_ = this;
+        if( !Nvic::setHandler(Nvic::IRQ_CAN1_SCE, &CanHealth::handleInterrupt) )
+        {
+            health_ = NULLPTR;
+            break;
+        }
+        isAbom_ = CanMcrAbom::read() != 0U;
+        CanMcr::modify( CanMcrAbom::clear() );
+        CanMsr::write( CanMsrErri::set() );
+        CanIer::modify( CanIerEwgie::set() | CanIerEpvie::set() | CanIerBofie::set() | CanIerErrie::set() );
+        static_cast<void>( Nvic::setPriority(Nvic::IRQ_CAN1_SCE, configMAX_SYSCALL_INTERRUPT_PRIORITY) );
+        static_cast<void>( Nvic::clearPending(Nvic::IRQ_CAN1_SCE) );
+        static_cast<void>( Nvic::enable(Nvic::IRQ_CAN1_SCE) );
+        update();
+        res = true;
+    } while(false);
+    return res;
+}
+
+void CanHealth::handleInterrupt()
+{
+    CanMsr::write( CanMsrErri::set() );
+    CanHealth* const health( health_ );
+    if( health != NULLPTR )
+    {
+        health->updateFromInterrupt();
+    }
+}
+
+} // namespace pcb
+} // namespace eoos
@@ -0,0 +1,196 @@
+/**
+ * @file      pcb.CanOpenNode.cpp
+ * @brief     EOOS CANopen node of process data objects
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "pcb.CanOpenNode.hpp"
+#include "pcb.CriticalSection.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+CanOpenNode::CanOpenNode(CanOpenBus& bus)
+    : lib::NonCopyable<lib::NoAllocator>()
+    , bus_( bus )
+    , tpdos_()
+    , rpdos_()
+    , tpdosNumber_( 0 )
+    , rpdosNumber_( 0 )
+    , syncCount_( 0U ) {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+CanOpenNode::~CanOpenNode()
+{
+}
+
+bool_t CanOpenNode::addTpdo(CanOpenPdo& pdo, uint32_t const transmissionType)
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() || !pdo.isConstructed() )
+        {
+            break;
+        }
+        if( (transmissionType < 1U) || (transmissionType > MAXIMUM_TRANSMISSION_TYPE) )
+        {
+            break;
+        }
+        if( tpdosNumber_ >= MAXIMUM_TPDOS )
+        {
+            break;
+        }
+        Tpdo& tpdo( tpdos_[tpdosNumber_] );
+        tpdo.pdo = &pdo;
+        tpdo.transmissionType = transmissionType;
+        tpdo.syncs = transmissionType;
+        tpdosNumber_++;
+        res = true;
+    } while(false);
+    return res;
+}
+
+bool_t CanOpenNode::addRpdo(CanOpenPdo& pdo)
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() || !pdo.isConstructed() )
+        {
+            break;
+        }
+        if( (rpdosNumber_ >= MAXIMUM_RPDOS) || (pdo.getCobId() == COB_ID_SYNC) )
+        {
+            break;
+        }
+        rpdos_[rpdosNumber_] = &pdo;
+        rpdosNumber_++;
+        res = true;
+    } while(false);
+    return res;
+}
+
+int32_t CanOpenNode::setReceiveFilters(drv::Can& can, drv::Can::RxFilter::Fifo const fifo, int32_t const index)
+{
+    int32_t banks( 0 );
+    if( isConstructed() )
+    {
+        // The list of identifiers is SYNC and the RPDOs, and the last identifier is repeated
+        // in the second place of the last bank, if the number of identifiers is odd
+        int32_t const number( rpdosNumber_ + 1 );
+        for(int32_t i(0); i<number; i += 2)
+        {
+            uint32_t const first( (i == 0) ? COB_ID_SYNC : rpdos_[i - 1]->getCobId() );
+            uint32_t const second( (i + 1 < number) ? rpdos_[i]->getCobId() : first );
+            drv::Can::RxFilter filter = {
+                .fifo = fifo,
+                .index = index + banks,
+                .mode = drv::Can::RxFilter::MODE_IDLIST,
+                .scale = drv::Can::RxFilter::SCALE_32BIT,
+                .filters = {
+                    .group32 = {
+                        .idList = {
+                            .id = {
+                                {
+                                    .bit = {
+                                        .rtr = 0,
+                                        .ide = 0,
+                                        .exid = 0,
+                                        .stid = first
+                                    }
+                                },
+                                {
+                                    .bit = {
+                                        .rtr = 0,
+                                        .ide = 0,
+                                        .exid = 0,
+                                        .stid = second
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            };
+            if( !can.setReceiveFilter(filter) )
+            {
+                banks = 0;
+                break;
+            }
+            banks++;
+        }
+    }
+    return banks;
+}
+
+bool_t CanOpenNode::handleMessage(drv::Can::Message const& message)
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() || message.ide )
+        {
+            break;
+        }
+        uint32_t const cobId( message.id.stid );
+        if( cobId == COB_ID_SYNC )
+        {
+            handleSync();
+            res = true;
+            break;
+        }
+        for(int32_t i(0); i<rpdosNumber_; i++)
+        {
+            CanOpenPdo* const pdo( rpdos_[i] );
+            if( pdo->getCobId() == cobId )
+            {
+                res = pdo->receive(message);
+                break;
+            }
+        }
+    } while(false);
+    return res;
+}
+
+uint32_t CanOpenNode::getSyncCount() const
+{
+    return syncCount_;
+}
+
+bool_t CanOpenNode::construct()
+{
+    return isConstructed();
+}
+
+void CanOpenNode::handleSync()
+{
+    syncCount_ = syncCount_ + 1U;
+    for(int32_t i(0); i<tpdosNumber_; i++)
+    {
+        Tpdo& tpdo( tpdos_[i] );
+        tpdo.syncs--;
+        if( tpdo.syncs == 0U )
+        {
+            tpdo.syncs = tpdo.transmissionType;
+            // The frame is copied in a critical section not to send an object written partly,
+            // and a PDO not put to a mailbox is lost as its data is stale on the next SYNC
+            drv::Can::Message message;
+            {
+                CriticalSection const section;
+                message = tpdo.pdo->getMessage();
+            }
+            if( bus_.transmit(message) )
+            {
+                tpdo.pdo->count();
+            }
+        }
+    }
+}
+
+} // namespace pcb
+} // namespace eoos
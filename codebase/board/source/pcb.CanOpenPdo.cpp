@@ -0,0 +1,99 @@
+/**
+ * @file      pcb.CanOpenPdo.cpp
+ * @brief     EOOS CANopen process data object
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "pcb.CanOpenPdo.hpp"
+#include "pcb.CriticalSection.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+namespace
+{
+
+const uint32_t COB_ID_MASK( 0x7FFU ); ///< Mask of an 11-bit COB-ID.
+const int32_t DLC_MAXIMUM( 8 );       ///< Maximum data length.
+
+} // namespace
+
+CanOpenPdo::CanOpenPdo(uint32_t const cobId, int32_t const dlc)
+    : lib::NonCopyable<lib::NoAllocator>()
+    , message_()
+    , count_( 0U ) {
+    message_.id.stid = cobId & COB_ID_MASK;
+    message_.id.exid = 0U;
+    message_.rtr = false;
+    message_.ide = false;
+    message_.dlc = dlc;
+    message_.data.v64[0] = 0U;
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+CanOpenPdo::~CanOpenPdo()
+{
+}
+
+uint32_t CanOpenPdo::getCobId() const
+{
+    return message_.id.stid;
+}
+
+drv::Can::Message& CanOpenPdo::getMessage()
+{
+    return message_;
+}
+
+drv::Can::Message const& CanOpenPdo::getMessage() const
+{
+    return message_;
+}
+
+bool_t CanOpenPdo::receive(drv::Can::Message const& message)
+{
+    bool_t res( false );
+    // A frame shorter than the mapping is rejected, and a longer one is
+    // taken as CANopen allows, without the bytes which are not mapped
+    if( isConstructed() && (message.dlc >= message_.dlc) && !message.rtr )
+    {
+        CriticalSection const section;
+        message_.data.v64[0] = message.data.v64[0];
+        count_ = count_ + 1U;
+        res = true;
+    }
+    return res;
+}
+
+uint32_t CanOpenPdo::getCount() const
+{
+    return count_;
+}
+
+void CanOpenPdo::count()
+{
+    count_ = count_ + 1U;
+}
+
+bool_t CanOpenPdo::construct()
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {
+            break;
+        }
+        if( (message_.dlc < 1) || (message_.dlc > DLC_MAXIMUM) )
+        {
+            break;
+        }
+        res = true;
+    } while(false);
+    return res;
+}
+
+} // namespace pcb
+} // namespace eoos
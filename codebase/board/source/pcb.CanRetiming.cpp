@@ -0,0 +1,114 @@
+/**
+ * @file      pcb.CanRetiming.cpp
+ * @brief     EOOS CAN bit timing retiming on clock changes
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "pcb.CanRetiming.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+namespace
+{
+
+/**
+ * @brief Address of CAN1 registers.
+ */
+const uint32_t ADDRESS_CAN1( 0x40006400U );
+
+const uint32_t MCR_INRQ( 0x00000001U );     ///< Initialization request.
+const uint32_t MSR_INAK( 0x00000001U );     ///< Initialization acknowledge.
+const uint32_t MSR_SLAK( 0x00000002U );     ///< Sleep acknowledge.
+const uint32_t TSR_TME( 0x1C000000U );      ///< Transmit mailboxes empty.
+const uint32_t BTR_BRP( 0x000003FFU );      ///< Baud rate prescaler.
+const uint32_t BTR_BRP_MAXIMUM( 1024U );    ///< Maximum prescaler.
+
+/**
+ * @brief Number of polls of a status flag.
+ */
+const int32_t STATUS_POLLS( 100000 );
+
+} // namespace
+
+CanRetiming::CanRetiming()
+    : ClockListener()
+    , reg_( *reinterpret_cast<Registers*>(ADDRESS_CAN1) )
+    , quantum_( 0U )
+    , isNormal_( false ) {
+}
+
+CanRetiming::~CanRetiming()
+{
+}
+
+bool_t CanRetiming::suspend(ClockFrequencies const& current, ClockFrequencies const& next)
+{
+    bool_t res( false );
+    do
+    {
+        quantum_ = 0U;
+        isNormal_ = false;
+        if( (reg_.msr & MSR_SLAK) != 0U )
+        {
+            res = true;
+            break;
+        }
+        uint32_t const btr( reg_.btr );
+        uint32_t const quantum( current.pclk1 / ((btr & BTR_BRP) + 1U) );
+        if( ((next.pclk1 % quantum) != 0U) || ((next.pclk1 / quantum) > BTR_BRP_MAXIMUM) )
+        {
+            break;
+        }
+        isNormal_ = (reg_.msr & MSR_INAK) == 0U;
+        if( isNormal_ )
+        {
+            // Let pending frames be sent at the current bit rate
+            int32_t polls( STATUS_POLLS );
+            while( ((reg_.tsr & TSR_TME) != TSR_TME) && (polls > 0) )
+            {
+                polls--;
+            }
+            reg_.mcr = reg_.mcr | MCR_INRQ;
+            if( !waitInitialization(true) )
+            {
+                reg_.mcr = reg_.mcr & ~MCR_INRQ;
+                isNormal_ = false;
+                break;
+            }
+        }
+        quantum_ = quantum;
+        res = true;
+    } while(false);
+    return res;
+}
+
+void CanRetiming::resume(ClockFrequencies const& frequencies)
+{
+    if( quantum_ != 0U )
+    {
+        uint32_t const prescaler( frequencies.pclk1 / quantum_ );
+        reg_.btr = (reg_.btr & ~BTR_BRP) | ((prescaler - 1U) & BTR_BRP);
+        if( isNormal_ )
+        {
+            reg_.mcr = reg_.mcr & ~MCR_INRQ;
+            static_cast<void>( waitInitialization(false) );
+        }
+    }
+    quantum_ = 0U;
+    isNormal_ = false;
+}
+
+bool_t CanRetiming::waitInitialization(bool_t const isSet)
+{
+    int32_t polls( STATUS_POLLS );
+    while( (((reg_.msr & MSR_INAK) != 0U) != isSet) && (polls > 0) )
+    {
+        polls--;
+    }
+    return polls > 0;
+}
+
+} // namespace pcb
+} // namespace eoos
@@ -0,0 +1,414 @@
+/**
+ * @file      pcb.CanTimeTrigger.cpp
+ * @brief     EOOS CAN time-triggered communication
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "pcb.CanTimeTrigger.hpp"
+#include "pcb.Clock.hpp"
+#include "pcb.ClockScaler.hpp"
+#include "pcb.Nvic.hpp"
+#include "pcb.Register.hpp"
+#include "FreeRTOS.h"
+#include "task.h"
+
+namespace eoos
+{
+namespace pcb
+{
+namespace
+{
+
+typedef Peripheral<0x40006400U> Can1; ///< CAN1 controller.
+typedef Peripheral<0x40000800U> Tim4; ///< TIM4 timer.
+typedef Peripheral<0x40021000U> Rcc;  ///< Reset and clock control.
+
+typedef Register<Can1, 0x000U> CanMcr;                          ///< Master control register.
+typedef Register<Can1, 0x004U, REGISTER_ACCESS_RO> CanMsr;      ///< Master status register.
+typedef Register<Can1, 0x008U, REGISTER_ACCESS_RC_W1> CanTsr;   ///< Transmit status register.
+typedef Register<Can1, 0x010U, REGISTER_ACCESS_RC_W1> CanRf1r;  ///< Receive FIFO 1 register.
+typedef Register<Can1, 0x01CU, REGISTER_ACCESS_RO> CanBtr;      ///< Bit timing register.
+typedef Register<Can1, 0x1A0U> CanTi2r;                         ///< Mailbox 2 identifier register.
+typedef Register<Can1, 0x1A4U> CanTdt2r;                        ///< Mailbox 2 data length control and time stamp register.
+typedef Register<Can1, 0x1A8U> CanTdl2r;                        ///< Mailbox 2 data low register.
+typedef Register<Can1, 0x1ACU> CanTdh2r;                        ///< Mailbox 2 data high register.
+typedef Register<Can1, 0x1C0U, REGISTER_ACCESS_RO> CanRi1r;     ///< FIFO 1 mailbox identifier register.
+typedef Register<Can1, 0x1C4U, REGISTER_ACCESS_RO> CanRdt1r;    ///< FIFO 1 mailbox data length control and time stamp register.
+typedef Register<Can1, 0x1C8U, REGISTER_ACCESS_RO> CanRdl1r;    ///< FIFO 1 mailbox data low register.
+typedef Register<Can1, 0x1CCU, REGISTER_ACCESS_RO> CanRdh1r;    ///< FIFO 1 mailbox data high register.
+
+typedef RegisterField<CanMcr, 0U> CanMcrInrq;                   ///< Initialization request.
+typedef RegisterField<CanMcr, 7U> CanMcrTtcm;                   ///< Time triggered communication mode.
+typedef RegisterField<CanMsr, 0U> CanMsrInak;                   ///< Initialization acknowledge.
+typedef RegisterField<CanMsr, 1U> CanMsrSlak;                   ///< Sleep acknowledge.
+typedef RegisterField<CanMsr, 10U, 2U> CanMsrTxmRxm;            ///< Transmit and receive modes.
+typedef RegisterField<CanTsr, 16U> CanTsrRqcp2;                 ///< Mailbox 2 request completed.
+typedef RegisterField<CanTsr, 17U> CanTsrTxok2;                 ///< Mailbox 2 transmission OK.
+typedef RegisterField<CanTsr, 28U> CanTsrTme2;                  ///< Mailbox 2 empty.
+typedef RegisterField<CanRf1r, 0U, 2U> CanRf1rFmp1;             ///< FIFO 1 message pending.
+typedef RegisterField<CanRf1r, 5U> CanRf1rRfom1;                ///< Release FIFO 1 output mailbox.
+typedef RegisterField<CanBtr, 0U, 10U> CanBtrBrp;               ///< Baud rate prescaler.
+typedef RegisterField<CanBtr, 16U, 4U> CanBtrTs1;               ///< Time segment 1.
+typedef RegisterField<CanBtr, 20U, 3U> CanBtrTs2;               ///< Time segment 2.
+typedef RegisterField<CanTi2r, 0U> CanTi2rTxrq;                 ///< Transmit mailbox request.
+typedef RegisterField<CanTdt2r, 0U, 4U> CanTdt2rDlc;            ///< Data length code.
+typedef RegisterField<CanTdt2r, 8U> CanTdt2rTgt;                ///< Transmit global time.
+typedef RegisterField<CanTdt2r, 16U, 16U> CanTdt2rTime;         ///< Time stamp of the frame sent.
+typedef RegisterField<CanRdt1r, 0U, 4U> CanRdt1rDlc;            ///< Data length code.
+typedef RegisterField<CanRdt1r, 16U, 16U> CanRdt1rTime;         ///< Time stamp of the frame received.
+
+typedef Register<Tim4, 0x00U> TimCr1;                           ///< Control register 1.
+typedef Register<Tim4, 0x0CU> TimDier;                          ///< DMA/interrupt enable register.
+typedef Register<Tim4, 0x10U> TimSr;                            ///< Status register.
+typedef Register<Tim4, 0x14U, REGISTER_ACCESS_WO> TimEgr;       ///< Event generation register.
+typedef Register<Tim4, 0x24U> TimCnt;                           ///< Counter.
+typedef Register<Tim4, 0x28U> TimPsc;                           ///< Prescaler.
+typedef Register<Tim4, 0x2CU> TimArr;                           ///< Auto-reload register.
+typedef Register<Tim4, 0x34U> TimCcr1;                          ///< Capture/compare register 1.
+
+typedef RegisterField<TimCr1, 0U> TimCr1Cen;                    ///< Counter enable.
+typedef RegisterField<TimDier, 1U> TimDierCc1ie;                ///< Capture/compare 1 interrupt enable.
+typedef RegisterField<TimSr, 1U> TimSrCc1if;                    ///< Capture/compare 1 interrupt flag.
+typedef RegisterField<TimEgr, 0U> TimEgrUg;                     ///< Update generation.
+
+typedef Register<Rcc, 0x1CU> RccApb1enr;                        ///< APB1 peripheral clock enable register.
+typedef RegisterField<RccApb1enr, 2U> RccApb1enrTim4en;         ///< TIM4 clock enable.
+
+const uint32_t ID_STID_SHIFT( 21U );     ///< Shift of standard identifier in identifier registers.
+const uint32_t ID_EXID_SHIFT( 3U );      ///< Shift of extended identifier in identifier registers.
+const uint32_t ID_EXID_MASK( 0x3FFFFU ); ///< Mask of extended identifier.
+const uint32_t ID_IDE( 0x00000004U );    ///< Identifier extension.
+const uint32_t ID_RTR( 0x00000002U );    ///< Remote transmission request.
+
+/**
+ * @brief Frequency of the timer ticks in Hz, which is one tick a microsecond.
+ */
+const uint32_t TICK_FREQUENCY( 1000000U );
+
+/**
+ * @brief Number of polls of a status flag.
+ */
+const int32_t STATUS_POLLS( 100000 );
+
+} // namespace
+
+CanTimeTrigger* CanTimeTrigger::trigger_( NULLPTR );
+
+CanTimeTrigger::CanTimeTrigger()
+    : lib::NonCopyable<lib::NoAllocator>()
+    , ClockListener()
+    , entries_( NULLPTR )
+    , number_( 0 )
+    , next_( 0 )
+    , ticksPerMicrosecond_( 0U )
+    , cyclesPerBit_( 0U )
+    , requestCycles_( 0U )
+    , isRequested_( false )
+    , referenceTime_( 0U )
+    , referenceCycles_( 0U )
+    , isCorrelated_( false )
+    , missed_( 0U ) {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+CanTimeTrigger::~CanTimeTrigger()
+{
+    if( trigger_ == this )
+    {
+        ClockScaler* const scaler( ClockScaler::get() );
+        if( scaler != NULLPTR )
+        {
+            static_cast<void>( scaler->removeListener(*this) );
+        }
+        stop();
+        static_cast<void>( Nvic::disable(Nvic::IRQ_TIM4) );
+        static_cast<void>( setTimeTriggered(false) );
+        trigger_ = NULLPTR;
+    }
+}
+
+bool_t CanTimeTrigger::start(Entry const* const entries, int32_t const number, uint32_t const cycle)
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {
+            break;
+        }
+        if( (entries == NULLPTR) || (number <= 0) || (cycle == 0U) || (cycle > MAXIMUM_CYCLE) )
+        {
+            break;
+        }
+        bool_t isValid( true );
+        for(int32_t i(0); i<number; i++)
+        {
+            Entry const& entry( entries[i] );
+            if( (entry.message == NULLPTR) || (entry.offset >= cycle) || ((i > 0) && (entry.offset <= entries[i - 1].offset)) )
+            {
+                isValid = false;
+                break;
+            }
+            if( entry.isTimeSent && (entry.message->dlc != 8) )
+            {
+                isValid = false;
+                break;
+            }
+        }
+        if( !isValid )
+        {
+            break;
+        }
+        stop();
+        entries_ = entries;
+        number_ = number;
+        next_ = 0;
+        TimPsc::write(ticksPerMicrosecond_ - 1U);
+        TimArr::write(cycle - 1U);
+        TimCcr1::write(entries[0].offset);
+        TimCnt::write(0U);
+        TimEgr::write( TimEgrUg::set() );
+        TimSr::write(0U);
+        TimDier::write( TimDierCc1ie::set() );
+        TimCr1::write( TimCr1Cen::set() );
+        res = true;
+    } while(false);
+    return res;
+}
+
+void CanTimeTrigger::stop()
+{
+    if( isConstructed() )
+    {
+        TimCr1::write(0U);
+        TimDier::write(0U);
+        TimSr::write(0U);
+        static_cast<void>( Nvic::clearPending(Nvic::IRQ_TIM4) );
+        entries_ = NULLPTR;
+        number_ = 0;
+    }
+}
+
+bool_t CanTimeTrigger::receive(TimedMessage* const message)
+{
+    bool_t res( false );
+    if( isConstructed() && (message != NULLPTR) && (CanRf1rFmp1::read() != 0U) )
+    {
+        uint32_t const rir( CanRi1r::read() );
+        uint32_t const rdtr( CanRdt1r::read() );
+        drv::Can::Message& frame( message->message );
+        frame.id.stid = rir >> ID_STID_SHIFT;
+        frame.id.exid = ((rir & ID_IDE) != 0U) ? ((rir >> ID_EXID_SHIFT) & ID_EXID_MASK) : 0U;
+        frame.ide = (rir & ID_IDE) != 0U;
+        frame.rtr = (rir & ID_RTR) != 0U;
+        frame.dlc = static_cast<int32_t>( rdtr & CanRdt1rDlc::MASK );
+        frame.data.v32[0] = CanRdl1r::read();
+        frame.data.v32[1] = CanRdh1r::read();
+        CanRf1r::write( CanRf1rRfom1::set() );
+        message->time = (rdtr & CanRdt1rTime::MASK) >> 16;
+        message->isCorrelated = toCycles(message->time, &message->cycles);
+        res = true;
+    }
+    return res;
+}
+
+bool_t CanTimeTrigger::toCycles(uint32_t const time, uint64_t* const cycles) const
+{
+    bool_t res( false );
+    UBaseType_t const mask( portSET_INTERRUPT_MASK_FROM_ISR() );
+    if( isCorrelated_ && (cycles != NULLPTR) )
+    {
+        // The difference is signed to convert times before and after the correlation
+        int32_t const bits( static_cast<int16_t>( static_cast<uint16_t>(time - referenceTime_) ) );
+        *cycles = referenceCycles_ + static_cast<uint64_t>( static_cast<int64_t>(bits) * static_cast<int64_t>(cyclesPerBit_) );
+        res = true;
+    }
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+    return res;
+}
+
+uint32_t CanTimeTrigger::getCyclesPerBit() const
+{
+    return cyclesPerBit_;
+}
+
+uint32_t CanTimeTrigger::getMissed() const
+{
+    return missed_;
+}
+
+bool_t CanTimeTrigger::suspend(ClockFrequencies const&, ClockFrequencies const& next)
+{
+    return (ClockScaler::getApb1TimerClock(next) % TICK_FREQUENCY) == 0U;
+}
+
+void CanTimeTrigger::resume(ClockFrequencies const& frequencies)
+{
+    setTiming(frequencies);
+    if( entries_ != NULLPTR )
+    {
+        // The prescaler is loaded on the next update event, so the current cycle ends at the old ticks
+        TimPsc::write(ticksPerMicrosecond_ - 1U);
+    }
+}
+
+bool_t CanTimeTrigger::construct()
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {
+            break;
+        }
+        if( trigger_ != NULLPTR )
+        {
+            break;
+        }
+        if( !setTimeTriggered(true) )
+        {
+            break;
+        }
+        ClockFrequencies const frequencies( ClockScaler::getFrequencies() );
+        if( (ClockScaler::getApb1TimerClock(frequencies) % TICK_FREQUENCY) != 0U )
+        {
+            static_cast<void>( setTimeTriggered(false) );
+            break;
+        }
+        setTiming(frequencies);
+        taskENTER_CRITICAL();
+        RccApb1enr::modify( RccApb1enrTim4en::set() );
+        taskEXIT_CRITICAL();
+        trigger_ = this;
+        stop();
+        if( !Nvic::setHandler(Nvic::IRQ_TIM4, &CanTimeTrigger::handleTimer) )
+        {
+            trigger_ = NULLPTR;
+            static_cast<void>( setTimeTriggered(false) );
+            break;
+        }
+        static_cast<void>( Nvic::setPriority(Nvic::IRQ_TIM4, configMAX_SYSCALL_INTERRUPT_PRIORITY) );
+        static_cast<void>( Nvic::enable(Nvic::IRQ_TIM4) );
+        ClockScaler* const scaler( ClockScaler::get() );
+        if( (scaler != NULLPTR) && !scaler->addListener(*this) )
+        {
+            static_cast<void>( Nvic::disable(Nvic::IRQ_TIM4) );
+            static_cast<void>( setTimeTriggered(false) );
+            trigger_ = NULLPTR;
+            break;
+        }
+        res = true;
+    } while(false);
+    return res;
+}
+
+bool_t CanTimeTrigger::setTimeTriggered(bool_t const isEnabled)
+{
+    bool_t res( false );
+    do
+    {
+        if( CanMsrSlak::read() != 0U )
+        {
+            break;
+        }
+        // The mode is set in the initialization mode only
+        CanMcr::modify( CanMcrInrq::set() );
+        int32_t polls( STATUS_POLLS );
+        while( (CanMsrInak::read() == 0U) && (polls > 0) )
+        {
+            polls--;
+        }
+        if( polls > 0 )
+        {
+            CanMcr::modify( isEnabled ? CanMcrTtcm::set() : CanMcrTtcm::clear() );
+        }
+        CanMcr::modify( CanMcrInrq::clear() );
+        while( (CanMsrInak::read() != 0U) && (polls > 0) )
+        {
+            polls--;
+        }
+        res = polls > 0;
+    } while(false);
+    return res;
+}
+
+void CanTimeTrigger::setTiming(ClockFrequencies const& frequencies)
+{
+    // TIM4 is on APB1
+    ticksPerMicrosecond_ = ClockScaler::getApb1TimerClock(frequencies) / TICK_FREQUENCY;
+    // The bit time is kept in cycles of the clock, which frequency does not depend on the profile
+    uint64_t const quanta( static_cast<uint64_t>(CanBtrBrp::read() + 1U) * (3U + CanBtrTs1::read() + CanBtrTs2::read()) );
+    cyclesPerBit_ = static_cast<uint32_t>( (static_cast<uint64_t>(Clock::FREQUENCY) * quanta) / frequencies.pclk1 );
+}
+
+void CanTimeTrigger::correlate()
+{
+    uint32_t const tsr( CanTsr::read() );
+    if( isRequested_ && CanTsrRqcp2::isSet(tsr) )
+    {
+        if( CanTsrTxok2::isSet(tsr) )
+        {
+            referenceTime_ = CanTdt2rTime::read();
+            referenceCycles_ = requestCycles_;
+            isCorrelated_ = true;
+        }
+        isRequested_ = false;
+    }
+}
+
+void CanTimeTrigger::send(Entry const& entry)
+{
+    do
+    {
+        uint32_t const tsr( CanTsr::read() );
+        if( !CanTsrTme2::isSet(tsr) )
+        {
+            missed_ = missed_ + 1U;
+            break;
+        }
+        CanTsr::write( CanTsrRqcp2::set() );
+        drv::Can::Message const& message( *entry.message );
+        uint32_t id( static_cast<uint32_t>(message.id.stid) << ID_STID_SHIFT );
+        if( message.ide )
+        {
+            id |= (static_cast<uint32_t>(message.id.exid) << ID_EXID_SHIFT) | ID_IDE;
+        }
+        if( message.rtr )
+        {
+            id |= ID_RTR;
+        }
+        CanTdt2r::Value tdtr( CanTdt2rDlc::value( static_cast<uint32_t>(message.dlc) ) );
+        if( entry.isTimeSent )
+        {
+            tdtr = tdtr | CanTdt2rTgt::set();
+        }
+        CanTdt2r::write(tdtr);
+        CanTdl2r::write(message.data.v32[0]);
+        CanTdh2r::write(message.data.v32[1]);
+        // A frame requested on an idle bus starts within a bit time, so its time stamp
+        // and the clock time of the request are taken as a correlation
+        bool_t const isIdle( CanMsrTxmRxm::read() == 0U );
+        uint64_t const cycles( Clock::getCycles() );
+        CanTi2r::write( id | CanTi2rTxrq::MASK );
+        requestCycles_ = cycles;
+        isRequested_ = isIdle;
+    } while(false);
+}
+
+void CanTimeTrigger::handleTimer()
+{
+    TimSr::write( ~TimSrCc1if::MASK );
+    CanTimeTrigger* const trigger( trigger_ );
+    if( (trigger != NULLPTR) && (trigger->entries_ != NULLPTR) )
+    {
+        trigger->correlate();
+        trigger->send( trigger->entries_[trigger->next_] );
+        int32_t const next( (trigger->next_ + 1 < trigger->number_) ? (trigger->next_ + 1) : 0 );
+        trigger->next_ = next;
+        TimCcr1::write( trigger->entries_[next].offset );
+    }
+}
+
+} // namespace pcb
+} // namespace eoos
@@ -0,0 +1,121 @@
+/**
+ * @file      pcb.Clock.cpp
+ * @brief     EOOS monotonic high-resolution clock
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "pcb.Clock.hpp"
+#include "pcb.CycleCounter.hpp"
+#include "task.h"
+
+namespace eoos
+{
+namespace pcb
+{
+
+uint64_t volatile Clock::time_( 0U );
+
+uint32_t volatile Clock::counter_( 0U );
+
+uint32_t volatile Clock::scale_( 1U );
+
+Clock::Clock()
+    : lib::NonCopyable<lib::NoAllocator>()
+    , Handler()
+    , ClockListener()
+    , timer_( *this, Timer::MODE_PERIODIC, PERIOD ) {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+Clock::~Clock()
+{
+    static_cast<void>( timer_.stop() );
+}
+
+void Clock::handle()
+{
+    static_cast<void>( getCycles() );
+}
+
+bool_t Clock::suspend(ClockFrequencies const&, ClockFrequencies const& next)
+{
+    // Count the cycles passed at the current CPU clock
+    static_cast<void>( getCycles() );
+    return (next.hclk != 0U) && ((FREQUENCY % next.hclk) == 0U);
+}
+
+void Clock::resume(ClockFrequencies const& frequencies)
+{
+    static_cast<void>( getCycles() );
+    scale_ = FREQUENCY / frequencies.hclk;
+}
+
+uint64_t Clock::getCycles()
+{
+    UBaseType_t const mask( portSET_INTERRUPT_MASK_FROM_ISR() );
+    uint32_t const counter( CycleCounter::get() );
+    uint64_t const time( time_ + static_cast<uint64_t>(counter - counter_) * scale_ );
+    counter_ = counter;
+    time_ = time;
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+    return time;
+}
+
+uint64_t Clock::getNanoseconds()
+{
+    return toNanoseconds( getCycles() );
+}
+
+uint64_t Clock::toNanoseconds(uint64_t const cycles)
+{
+    return (cycles / FREQUENCY) * NANOSECONDS + ((cycles % FREQUENCY) * NANOSECONDS) / FREQUENCY;
+}
+
+uint64_t Clock::toCycles(uint64_t const nanoseconds)
+{
+    return (nanoseconds / NANOSECONDS) * FREQUENCY + ((nanoseconds % NANOSECONDS) * FREQUENCY) / NANOSECONDS;
+}
+
+void Clock::sleepUntil(uint64_t const time)
+{
+    uint64_t const cyclesPerTick( FREQUENCY / configTICK_RATE_HZ );
+    uint64_t now( getCycles() );
+    while( now < time )
+    {
+        uint64_t const ticks( (time - now + cyclesPerTick - 1U) / cyclesPerTick );
+        vTaskDelay( static_cast<TickType_t>(ticks) );
+        now = getCycles();
+    }
+}
+
+bool_t Clock::construct()
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {
+            break;
+        }
+        if( !timer_.isConstructed() )
+        {
+            break;
+        }
+        if( !CycleCounter::initialize() )
+        {
+            break;
+        }
+        counter_ = CycleCounter::get();
+        time_ = counter_;
+        if( !timer_.start() )
+        {
+            break;
+        }
+        res = true;
+    } while(false);
+    return res;
+}
+
+} // namespace pcb
+} // namespace eoos
@@ -0,0 +1,300 @@
+/**
+ * @file      pcb.ClockScaler.cpp
+ * @brief     EOOS clock frequency scaling
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "pcb.ClockScaler.hpp"
+#include "pcb.Register.hpp"
+#include "FreeRTOS.h"
+#include "task.h"
+
+namespace eoos
+{
+namespace pcb
+{
+namespace
+{
+
+typedef Peripheral<0x40021000U> Rcc;     ///< Reset and clock control.
+typedef Peripheral<0x40022000U> Flash;   ///< FLASH interface.
+typedef Peripheral<0xE000E010U> SysTick; ///< System timer.
+
+typedef Register<Rcc, 0x00U> RccCr;                     ///< Clock control register.
+typedef Register<Rcc, 0x04U> RccCfgr;                   ///< Clock configuration register.
+
+typedef RegisterField<RccCr, 16U> RccCrHseon;           ///< HSE clock enable.
+typedef RegisterField<RccCr, 17U> RccCrHserdy;          ///< HSE clock ready flag.
+typedef RegisterField<RccCr, 24U> RccCrPllon;           ///< PLL enable.
+typedef RegisterField<RccCr, 25U> RccCrPllrdy;          ///< PLL clock ready flag.
+
+typedef RegisterField<RccCfgr, 0U, 2U> RccCfgrSw;       ///< System clock switch.
+typedef RegisterField<RccCfgr, 2U, 2U> RccCfgrSws;      ///< System clock switch status.
+typedef RegisterField<RccCfgr, 4U, 4U> RccCfgrHpre;     ///< AHB prescaler.
+typedef RegisterField<RccCfgr, 8U, 3U> RccCfgrPpre1;    ///< APB1 prescaler.
+typedef RegisterField<RccCfgr, 11U, 3U> RccCfgrPpre2;   ///< APB2 prescaler.
+typedef RegisterField<RccCfgr, 16U> RccCfgrPllsrc;      ///< PLL entry clock source.
+typedef RegisterField<RccCfgr, 17U> RccCfgrPllxtpre;    ///< HSE divider for PLL entry.
+typedef RegisterField<RccCfgr, 18U, 4U> RccCfgrPllmul;  ///< PLL multiplication factor.
+
+typedef Register<Flash, 0x00U> FlashAcr;                ///< FLASH access control register.
+typedef RegisterField<FlashAcr, 0U, 3U> FlashAcrLatency; ///< FLASH wait states.
+typedef RegisterField<FlashAcr, 4U> FlashAcrPrftbe;     ///< Prefetch buffer enable.
+
+typedef Register<SysTick, 0x04U> SysTickLoad;           ///< Reload value register.
+typedef Register<SysTick, 0x08U> SysTickVal;            ///< Current value register.
+
+const uint32_t SW_HSE( 1U );            ///< HSE selected as system clock.
+const uint32_t SW_PLL( 2U );            ///< PLL selected as system clock.
+const uint32_t PPRE_DIV1( 0U );         ///< APB clock not divided.
+const uint32_t PPRE_DIV2( 4U );         ///< APB clock divided by 2.
+const uint32_t PLLMUL_9( 7U );          ///< PLL input clock multiplied by 9.
+const uint32_t LATENCY_72MHZ( 2U );     ///< Two wait states for SYSCLK above 48 MHz.
+const uint32_t LATENCY_24MHZ( 0U );     ///< Zero wait states for SYSCLK up to 24 MHz.
+
+/**
+ * @brief Number of polls of a ready flag.
+ */
+const int32_t READY_POLLS( 100000 );
+
+} // namespace
+
+ClockScaler* ClockScaler::scaler_( NULLPTR );
+
+ClockScaler::ClockScaler()
+    : lib::NonCopyable<lib::NoAllocator>()
+    , listeners_()
+    , profile_( PROFILE_PERFORMANCE ) {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+ClockScaler::~ClockScaler()
+{
+    if( scaler_ == this )
+    {
+        scaler_ = NULLPTR;
+    }
+}
+
+bool_t ClockScaler::addListener(ClockListener& listener)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        taskENTER_CRITICAL();
+        for(int32_t i(0); i<MAXIMUM_LISTENERS; i++)
+        {
+            if( listeners_[i] == NULLPTR )
+            {
+                listeners_[i] = &listener;
+                res = true;
+                break;
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+    return res;
+}
+
+bool_t ClockScaler::removeListener(ClockListener& listener)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        taskENTER_CRITICAL();
+        for(int32_t i(0); i<MAXIMUM_LISTENERS; i++)
+        {
+            if( listeners_[i] == &listener )
+            {
+                listeners_[i] = NULLPTR;
+                res = true;
+                break;
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+    return res;
+}
+
+bool_t ClockScaler::setProfile(Profile const profile)
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {
+            break;
+        }
+        if( profile == profile_ )
+        {
+            res = true;
+            break;
+        }
+        ClockFrequencies const current( getFrequencies(profile_) );
+        ClockFrequencies const next( getFrequencies(profile) );
+        taskENTER_CRITICAL();
+        int32_t suspended( 0 );
+        bool_t isReady( true );
+        while( suspended < MAXIMUM_LISTENERS )
+        {
+            ClockListener* const listener( listeners_[suspended] );
+            if( (listener != NULLPTR) && !listener->suspend(current, next) )
+            {
+                isReady = false;
+                break;
+            }
+            suspended++;
+        }
+        if( isReady )
+        {
+            isReady = switchClocks(profile);
+        }
+        if( isReady )
+        {
+            setTick(next.hclk);
+            profile_ = profile;
+        }
+        for(int32_t i(0); i<suspended; i++)
+        {
+            ClockListener* const listener( listeners_[i] );
+            if( listener != NULLPTR )
+            {
+                listener->resume( isReady ? next : current );
+            }
+        }
+        taskEXIT_CRITICAL();
+        res = isReady;
+    } while(false);
+    return res;
+}
+
+ClockScaler::Profile ClockScaler::getProfile() const
+{
+    return profile_;
+}
+
+ClockScaler* ClockScaler::get()
+{
+    return scaler_;
+}
+
+ClockFrequencies ClockScaler::getFrequencies(Profile const profile)
+{
+    ClockFrequencies frequencies = {
+        .hclk  = HSE_FREQUENCY * 9U,
+        .pclk1 = HSE_FREQUENCY * 9U / 2U,
+        .pclk2 = HSE_FREQUENCY * 9U
+    };
+    if( profile == PROFILE_LOW_POWER )
+    {
+        frequencies.hclk = HSE_FREQUENCY;
+        frequencies.pclk1 = HSE_FREQUENCY;
+        frequencies.pclk2 = HSE_FREQUENCY;
+    }
+    return frequencies;
+}
+
+ClockFrequencies ClockScaler::getFrequencies()
+{
+    ClockScaler const* const scaler( scaler_ );
+    Profile const profile( (scaler != NULLPTR) ? scaler->profile_ : PROFILE_PERFORMANCE );
+    return getFrequencies(profile);
+}
+
+uint32_t ClockScaler::getApb1TimerClock(ClockFrequencies const& frequencies)
+{
+    return (frequencies.pclk1 == frequencies.hclk) ? frequencies.pclk1 : (frequencies.pclk1 * 2U);
+}
+
+bool_t ClockScaler::construct()
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {
+            break;
+        }
+        if( scaler_ != NULLPTR )
+        {
+            break;
+        }
+        scaler_ = this;
+        res = true;
+    } while(false);
+    return res;
+}
+
+bool_t ClockScaler::switchClocks(Profile const profile)
+{
+    bool_t res( false );
+    int32_t polls( READY_POLLS );
+    if( profile == PROFILE_PERFORMANCE )
+    {
+        RccCfgr::modify( RccCfgrPllsrc::set() | RccCfgrPllxtpre::clear() | RccCfgrPllmul::value(PLLMUL_9) );
+        RccCr::modify( RccCrPllon::set() );
+        while( (RccCrPllrdy::read() == 0U) && (polls > 0) )
+        {
+            polls--;
+        }
+        if( polls > 0 )
+        {
+            // Increase FLASH wait states and divide APB1 to its maximum of 36 MHz after the PLL is locked
+            // and before SYSCLK is increased, so that the clocks are kept if the PLL fails
+            FlashAcr::modify( FlashAcrPrftbe::set() | FlashAcrLatency::value(LATENCY_72MHZ) );
+            RccCfgr::modify( RccCfgrHpre::clear() | RccCfgrPpre1::value(PPRE_DIV2) | RccCfgrPpre2::value(PPRE_DIV1) );
+            RccCfgrSw::modify(SW_PLL);
+            while( (RccCfgrSws::read() != SW_PLL) && (polls > 0) )
+            {
+                polls--;
+            }
+            if( polls == 0 )
+            {
+                // SYSCLK is still HSE, so the prescalers and the wait states of the current profile are restored
+                RccCfgrSw::modify(SW_HSE);
+                RccCfgr::modify( RccCfgrPpre1::value(PPRE_DIV1) );
+                FlashAcr::modify( FlashAcrLatency::value(LATENCY_24MHZ) );
+            }
+        }
+        if( polls == 0 )
+        {
+            RccCr::modify( RccCrPllon::clear() );
+        }
+        res = polls > 0;
+    }
+    else
+    {
+        RccCr::modify( RccCrHseon::set() );
+        while( (RccCrHserdy::read() == 0U) && (polls > 0) )
+        {
+            polls--;
+        }
+        if( polls > 0 )
+        {
+            RccCfgrSw::modify(SW_HSE);
+            while( (RccCfgrSws::read() != SW_HSE) && (polls > 0) )
+            {
+                polls--;
+            }
+        }
+        if( polls > 0 )
+        {
+            // Decrease FLASH wait states and undivide APB1 after SYSCLK is decreased
+            RccCfgr::modify( RccCfgrHpre::clear() | RccCfgrPpre1::value(PPRE_DIV1) | RccCfgrPpre2::value(PPRE_DIV1) );
+            RccCr::modify( RccCrPllon::clear() );
+            FlashAcr::modify( FlashAcrLatency::value(LATENCY_24MHZ) );
+        }
+        res = polls > 0;
+    }
+    return res;
+}
+
+void ClockScaler::setTick(uint32_t const hclk)
+{
+    SysTickLoad::write( hclk / static_cast<uint32_t>(configTICK_RATE_HZ) - 1U );
+    SysTickVal::write(0U);
+}
+
+} // namespace pcb
+} // namespace eoos
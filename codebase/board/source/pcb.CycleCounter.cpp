@@ -0,0 +1,48 @@
+/**
+ * @file      pcb.CycleCounter.cpp
+ * @brief     EOOS CPU cycle counter
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "pcb.CycleCounter.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+namespace
+{
+
+/**
+ * @brief Address of Debug Exception and Monitor Control Register.
+ */
+const uint32_t ADDRESS_DEMCR( 0xE000EDFCU );
+
+/**
+ * @brief Address of DWT control register.
+ */
+const uint32_t ADDRESS_DWT_CTRL( 0xE0001000U );
+
+/**
+ * @brief DEMCR bit to enable DWT and ITM units.
+ */
+const uint32_t DEMCR_TRCENA( 0x01000000U );
+
+/**
+ * @brief DWT_CTRL bit to enable the cycle counter.
+ */
+const uint32_t DWT_CTRL_CYCCNTENA( 0x00000001U );
+
+} // namespace
+
+bool_t CycleCounter::initialize()
+{
+    uint32_t volatile& demcr( *reinterpret_cast<uint32_t volatile*>(ADDRESS_DEMCR) );
+    uint32_t volatile& ctrl( *reinterpret_cast<uint32_t volatile*>(ADDRESS_DWT_CTRL) );
+    demcr |= DEMCR_TRCENA;
+    ctrl |= DWT_CTRL_CYCCNTENA;
+    return (ctrl & DWT_CTRL_CYCCNTENA) != 0U;
+}
+
+} // namespace pcb
+} // namespace eoos
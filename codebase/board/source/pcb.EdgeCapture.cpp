@@ -0,0 +1,315 @@
+/**
+ * @file      pcb.EdgeCapture.cpp
+ * @brief     EOOS GPIO edge capture
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "pcb.EdgeCapture.hpp"
+#include "pcb.CycleCounter.hpp"
+#include "pcb.Nvic.hpp"
+#include "pcb.Register.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+namespace
+{
+
+typedef Peripheral<0x40010400U> Exti; ///< External interrupt/event controller.
+typedef Peripheral<0x40021000U> Rcc;  ///< Reset and clock control.
+
+typedef Register<Exti, 0x00U> ExtiImr;                          ///< Interrupt mask register.
+typedef Register<Exti, 0x08U> ExtiRtsr;                         ///< Rising trigger selection register.
+typedef Register<Exti, 0x0CU> ExtiFtsr;                         ///< Falling trigger selection register.
+typedef Register<Exti, 0x10U> ExtiSwier;                        ///< Software interrupt event register.
+typedef Register<Exti, 0x14U, REGISTER_ACCESS_RC_W1> ExtiPr;    ///< Pending register.
+
+typedef Register<Rcc, 0x18U> RccApb2enr;                        ///< APB2 peripheral clock enable register.
+typedef RegisterField<RccApb2enr, 0U> RccApb2enrAfioen;         ///< AFIO clock enable.
+
+/**
+ * @brief Address of AFIO external interrupt configuration register 1.
+ */
+const uint32_t ADDRESS_AFIO_EXTICR1( 0x40010008U );
+
+} // namespace
+
+EdgeCapture* EdgeCapture::captures_[16] = { NULLPTR };
+
+EdgeCapture::EdgeCapture(Config const& config)
+    : lib::NonCopyable<lib::NoAllocator>()
+    , port_( config.port )
+    , mask_( 0U )
+    , line_( -1 )
+    , batch_( config.batch )
+    , notifier_( Notifier::TYPE_BINARY )
+    , events_()
+    , head_( 0U )
+    , tail_( 0U )
+    , lost_( 0U ) {
+    bool_t const isConstructed( construct(config) );
+    setConstructed( isConstructed );
+}
+
+EdgeCapture::~EdgeCapture()
+{
+    if( (line_ >= 0) && (captures_[line_] == this) )
+    {
+        taskENTER_CRITICAL();
+        ExtiImr::modify( ExtiImr::Value(mask_, 0U) );
+        ExtiRtsr::modify( ExtiRtsr::Value(mask_, 0U) );
+        ExtiFtsr::modify( ExtiFtsr::Value(mask_, 0U) );
+        ExtiPr::write(mask_);
+        captures_[line_] = NULLPTR;
+        int32_t const irq( getIrq(line_) );
+        bool_t isShared( false );
+        for(int32_t line(0); line<16; line++)
+        {
+            if( (captures_[line] != NULLPTR) && (getIrq(line) == irq) )
+            {
+                isShared = true;
+            }
+        }
+        if( !isShared )
+        {
+            static_cast<void>( Nvic::disable(irq) );
+        }
+        taskEXIT_CRITICAL();
+    }
+}
+
+int32_t EdgeCapture::read(Event* const events, int32_t const size, int32_t const timeout)
+{
+    int32_t res( 0 );
+    if( isConstructed() && (events != NULLPTR) && (size > 0) )
+    {
+        // A notification may be left by a batch read before, so wait in a loop until the time is over
+        TickType_t const start( xTaskGetTickCount() );
+        int32_t left( timeout );
+        while( getCount() < batch_ )
+        {
+            if( !notifier_.wait(left) )
+            {
+                break;
+            }
+            if( timeout != TIMEOUT_INFINITE )
+            {
+                int32_t const elapsed( static_cast<int32_t>( (xTaskGetTickCount() - start) * portTICK_PERIOD_MS ) );
+                if( elapsed >= timeout )
+                {
+                    break;
+                }
+                left = timeout - elapsed;
+            }
+        }
+        int32_t count( getCount() );
+        if( count > size )
+        {
+            count = size;
+        }
+        uint32_t tail( tail_ );
+        for(int32_t i(0); i<count; i++)
+        {
+            Event volatile const& event( events_[tail % static_cast<uint32_t>(CAPACITY)] );
+            events[i].time = event.time;
+            events[i].level = event.level;
+            tail++;
+        }
+        tail_ = tail;
+        res = count;
+    }
+    return res;
+}
+
+uint32_t EdgeCapture::getLost() const
+{
+    return lost_;
+}
+
+void EdgeCapture::generate()
+{
+    if( isConstructed() )
+    {
+        ExtiSwier::write(mask_);
+    }
+}
+
+bool_t EdgeCapture::construct(Config const& config)
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {
+            break;
+        }
+        if( (config.pin < 0) || (config.pin > 15) )
+        {
+            break;
+        }
+        if( (config.batch < 1) || (config.batch > CAPACITY) )
+        {
+            break;
+        }
+        if( (config.edge & EDGE_BOTH) == 0 )
+        {
+            break;
+        }
+        if( !notifier_.bind() )
+        {
+            break;
+        }
+        mask_ = static_cast<uint32_t>(1) << config.pin;
+        uint32_t volatile& exticr( *reinterpret_cast<uint32_t volatile*>(ADDRESS_AFIO_EXTICR1 + (static_cast<uint32_t>(config.pin) >> 2) * 4U) );
+        uint32_t const shift( (static_cast<uint32_t>(config.pin) & 0x3U) * 4U );
+        bool_t isBusy( false );
+        taskENTER_CRITICAL();
+        if( captures_[config.pin] == NULLPTR )
+        {
+            RccApb2enr::modify( RccApb2enrAfioen::set() );
+            exticr = (exticr & ~(static_cast<uint32_t>(0xFU) << shift)) | (static_cast<uint32_t>(config.port) << shift);
+            ExtiRtsr::modify( ExtiRtsr::Value(mask_, ((config.edge & EDGE_RISING) != 0) ? mask_ : 0U) );
+            ExtiFtsr::modify( ExtiFtsr::Value(mask_, ((config.edge & EDGE_FALLING) != 0) ? mask_ : 0U) );
+            captures_[config.pin] = this;
+            line_ = config.pin;
+        }
+        else
+        {
+            isBusy = true;
+        }
+        taskEXIT_CRITICAL();
+        if( isBusy )
+        {
+            break;
+        }
+        // Configure the pin after the line is claimed, so that a pin of another capture is not changed
+        port_.configure(mask_, config.pull ? GpioPort::MODE_INPUT_PULL : GpioPort::MODE_INPUT_FLOATING);
+        ExtiPr::write(mask_);
+        int32_t const irq( getIrq(line_) );
+        Nvic::Handler handler( &EdgeCapture::handleExti15To10 );
+        switch( line_ )
+        {
+            case 0:  handler = &EdgeCapture::handleExti0;    break;
+            case 1:  handler = &EdgeCapture::handleExti1;    break;
+            case 2:  handler = &EdgeCapture::handleExti2;    break;
+            case 3:  handler = &EdgeCapture::handleExti3;    break;
+            case 4:  handler = &EdgeCapture::handleExti4;    break;
+            case 5:
+            case 6:
+            case 7:
+            case 8:
+            case 9:  handler = &EdgeCapture::handleExti9To5; break;
+            default: break;
+        }
+        if( !Nvic::setHandler(irq, handler) )
+        {
+            break;
+        }
+        static_cast<void>( Nvic::setPriority(irq, configMAX_SYSCALL_INTERRUPT_PRIORITY) );
+        static_cast<void>( Nvic::clearPending(irq) );
+        ExtiImr::modify( ExtiImr::Value(mask_, mask_) );
+        static_cast<void>( Nvic::enable(irq) );
+        res = true;
+    } while(false);
+    return res;
+}
+
+void EdgeCapture::capture(uint32_t const time)
+{
+    uint32_t const head( head_ );
+    int32_t const count( static_cast<int32_t>(head - tail_) );
+    if( count < CAPACITY )
+    {
+        Event volatile& event( events_[head % static_cast<uint32_t>(CAPACITY)] );
+        event.time = time;
+        event.level = ((port_.read() & mask_) != 0U) ? 1U : 0U;
+        head_ = head + 1U;
+        if( (count + 1) >= batch_ )
+        {
+            static_cast<void>( notifier_.notifyFromInterrupt() );
+        }
+    }
+    else
+    {
+        lost_ = lost_ + 1U;
+    }
+}
+
+int32_t EdgeCapture::getCount() const
+{
+    return static_cast<int32_t>(head_ - tail_);
+}
+
+void EdgeCapture::handle(uint32_t const time, int32_t const first, int32_t const last)
+{
+    uint32_t const pr( ExtiPr::read() );
+    for(int32_t line(first); line<=last; line++)
+    {
+        uint32_t const mask( static_cast<uint32_t>(1) << line );
+        if( (pr & mask) != 0U )
+        {
+            ExtiPr::write(mask);
+            EdgeCapture* const capture( captures_[line] );
+            if( capture != NULLPTR )
+            {
+                capture->capture(time);
+            }
+        }
+    }
+}
+
+void EdgeCapture::handleExti0()
+{
+    handle(CycleCounter::get(), 0, 0);
+}
+
+void EdgeCapture::handleExti1()
+{
+    handle(CycleCounter::get(), 1, 1);
+}
+
+void EdgeCapture::handleExti2()
+{
+    handle(CycleCounter::get(), 2, 2);
+}
+
+void EdgeCapture::handleExti3()
+{
+    handle(CycleCounter::get(), 3, 3);
+}
+
+void EdgeCapture::handleExti4()
+{
+    handle(CycleCounter::get(), 4, 4);
+}
+
+void EdgeCapture::handleExti9To5()
+{
+    handle(CycleCounter::get(), 5, 9);
+}
+
+void EdgeCapture::handleExti15To10()
+{
+    handle(CycleCounter::get(), 10, 15);
+}
+
+int32_t EdgeCapture::getIrq(int32_t const line)
+{
+    int32_t irq( Nvic::IRQ_EXTI15_10 );
+    if( line <= 4 )
+    {
+        irq = Nvic::IRQ_EXTI0 + line;
+    }
+    else if( line <= 9 )
+    {
+        irq = Nvic::IRQ_EXTI9_5;
+    }
+    else
+    {
+    }
+    return irq;
+}
+
+} // namespace pcb
+} // namespace eoos
@@ -0,0 +1,176 @@
+/**
+ * @file      pcb.EventGroup.cpp
+ * @brief     EOOS event group
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "pcb.EventGroup.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+EventGroup::EventGroup()
+    : lib::NonCopyable<lib::NoAllocator>()
+    , buffer_()
+    , handle_( NULLPTR ) {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+EventGroup::~EventGroup()
+{
+    if( handle_ != NULLPTR )
+    {
+        vEventGroupDelete(handle_);
+    }
+}
+
+bool_t EventGroup::setBits(uint32_t const bits)
+{
+    bool_t res( false );
+    if( isConstructed() && ((bits & ~BITS_MASK) == 0U) )
+    {
+        static_cast<void>( xEventGroupSetBits(handle_, static_cast<EventBits_t>(bits)) );
+        res = true;
+    }
+    return res;
+}
+
+bool_t EventGroup::setBitsFromInterrupt(uint32_t const bits)
+{
+    bool_t res( false );
+    if( isConstructed() && ((bits & ~BITS_MASK) == 0U) )
+    {
+        BaseType_t isWoken( pdFALSE );
+        BaseType_t const isPosted( xEventGroupSetBitsFromISR(handle_, static_cast<EventBits_t>(bits), &isWoken) );
+        if( isPosted == pdPASS )
+        {
+            portYIELD_FROM_ISR(isWoken);
+            res = true;
+        }
+    }
+    return res;
+}
+
+uint32_t EventGroup::clearBits(uint32_t const bits)
+{
+    uint32_t res( 0U );
+    if( isConstructed() )
+    {
+        res = static_cast<uint32_t>( xEventGroupClearBits(handle_, static_cast<EventBits_t>(bits & BITS_MASK)) );
+    }
+    return res;
+}
+
+uint32_t EventGroup::getBits() const
+{
+    uint32_t res( 0U );
+    if( isConstructed() )
+    {
+        res = static_cast<uint32_t>( xEventGroupGetBits(handle_) );
+    }
+    return res;
+}
+
+uint32_t EventGroup::waitAny(uint32_t const bits, int32_t const timeout, bool_t const clear)
+{
+    return wait(bits, timeout, clear, false);
+}
+
+uint32_t EventGroup::waitAll(uint32_t const bits, int32_t const timeout, bool_t const clear)
+{
+    return wait(bits, timeout, clear, true);
+}
+
+bool_t EventGroup::construct()
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {
+            break;
+        }
+        handle_ = xEventGroupCreateStatic(&buffer_);
+        if( handle_ == NULLPTR )
+        {
+            break;
+        }
+        res = true;
+    } while(false);
+    return res;
+}
+
+uint32_t EventGroup::wait(uint32_t const bits, int32_t const timeout, bool_t const clear, bool_t const all)
+{
+    uint32_t res( 0U );
+    do
+    {
+        if( !isConstructed() )
+        {
+            break;
+        }
+        if( (bits == 0U) || ((bits & ~BITS_MASK) != 0U) )
+        {
+            break;
+        }
+        BaseType_t const isClear( clear ? pdTRUE : pdFALSE );
+        BaseType_t const isAll( all ? pdTRUE : pdFALSE );
+        uint32_t const value( static_cast<uint32_t>( xEventGroupWaitBits(handle_, static_cast<EventBits_t>(bits), isClear, isAll, toTicks(timeout)) ) );
+        uint32_t const set( value & bits );
+        if( all )
+        {
+            res = (set == bits) ? set : 0U;
+        }
+        else
+        {
+            res = set;
+        }
+    } while(false);
+    return res;
+}
+
+TickType_t EventGroup::toTicks(int32_t const timeout)
+{
+    TickType_t ticks( portMAX_DELAY );
+    if( timeout >= 0 )
+    {
+        ticks = pdMS_TO_TICKS( static_cast<TickType_t>(timeout) );
+    }
+    return ticks;
+}
+
+EventFlag::EventFlag(EventGroup& group, int32_t const bit)
+    : group_( group )
+    , mask_( ((bit >= 0) && (bit < 24)) ? (static_cast<uint32_t>(1) << bit) : 0U ) {
+}
+
+uint32_t EventFlag::getMask() const
+{
+    return mask_;
+}
+
+bool_t EventFlag::raise()
+{
+    bool_t res( false );
+    if( mask_ != 0U )
+    {
+        res = group_.setBits(mask_);
+    }
+    return res;
+}
+
+bool_t EventFlag::raiseFromInterrupt()
+{
+    bool_t res( false );
+    if( mask_ != 0U )
+    {
+        res = group_.setBitsFromInterrupt(mask_);
+    }
+    return res;
+}
+
+} // namespace pcb
+} // namespace eoos
@@ -0,0 +1,300 @@
+/**
+ * @file      pcb.Formatter.cpp
+ * @brief     EOOS buffered formatter of output streams
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "pcb.Formatter.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+namespace
+{
+
+/**
+ * @brief Decimal digit pairs from 00 to 99.
+ */
+const char_t DIGIT_PAIRS[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+/**
+ * @brief Hexadecimal digits.
+ */
+const char_t HEX_DIGITS[] = "0123456789ABCDEF";
+
+/**
+ * @brief Powers of ten from 10^19 to 10^9 to reduce 64-bit integers.
+ */
+const uint64_t POWERS_OF_TEN[] = {
+    10000000000000000000ULL,
+    1000000000000000000ULL,
+    100000000000000000ULL,
+    10000000000000000ULL,
+    1000000000000000ULL,
+    100000000000000ULL,
+    10000000000000ULL,
+    1000000000000ULL,
+    100000000000ULL,
+    10000000000ULL,
+    1000000000ULL
+};
+
+/**
+ * @brief Number of digits of 10^9 - 1.
+ */
+const int32_t LOW_DIGITS( 9 );
+
+/**
+ * @brief Converts an integer less than 10^9 to decimal from the end of a string.
+ *
+ * @param value Integer.
+ * @param end   End of the string.
+ * @return Beginning of the converted digits.
+ */
+char_t* convert(uint32_t value, char_t* end)
+{
+    while( value >= 100U )
+    {
+        uint32_t const quotient( value / 100U );
+        uint32_t const pair( (value - quotient * 100U) * 2U );
+        *--end = DIGIT_PAIRS[pair + 1U];
+        *--end = DIGIT_PAIRS[pair];
+        value = quotient;
+    }
+    if( value >= 10U )
+    {
+        uint32_t const pair( value * 2U );
+        *--end = DIGIT_PAIRS[pair + 1U];
+        *--end = DIGIT_PAIRS[pair];
+    }
+    else
+    {
+        *--end = static_cast<char_t>('0' + value);
+    }
+    return end;
+}
+
+} // namespace
+
+Formatter::Formatter(api::OutStream<char_t>& stream)
+    : lib::NonCopyable<lib::NoAllocator>()
+    , stream_( stream )
+    , length_( 0 )
+    , buffer_() {
+}
+
+Formatter::~Formatter()
+{
+    static_cast<void>( flush() );
+}
+
+Formatter& Formatter::operator<<(char_t const* string)
+{
+    if( string != NULLPTR )
+    {
+        int32_t length( 0 );
+        while( string[length] != '\0' )
+        {
+            length++;
+        }
+        put(string, length);
+    }
+    return *this;
+}
+
+Formatter& Formatter::operator<<(char_t const character)
+{
+    put(&character, 1);
+    return *this;
+}
+
+Formatter& Formatter::operator<<(int32_t const value)
+{
+    char_t string[NUMBER_SIZE + 1];
+    uint32_t magnitude( static_cast<uint32_t>(value) );
+    int32_t length( 0 );
+    if( value < 0 )
+    {
+        string[length++] = '-';
+        magnitude = 0U - magnitude;
+    }
+    length += toDecimal(magnitude, &string[length]);
+    put(string, length);
+    return *this;
+}
+
+Formatter& Formatter::operator<<(uint32_t const value)
+{
+    char_t string[NUMBER_SIZE];
+    int32_t const length( toDecimal(value, string) );
+    put(string, length);
+    return *this;
+}
+
+Formatter& Formatter::operator<<(int64_t const value)
+{
+    char_t string[NUMBER_SIZE + 1];
+    uint64_t magnitude( static_cast<uint64_t>(value) );
+    int32_t length( 0 );
+    if( value < 0 )
+    {
+        string[length++] = '-';
+        magnitude = 0U - magnitude;
+    }
+    length += toDecimal(magnitude, &string[length]);
+    put(string, length);
+    return *this;
+}
+
+Formatter& Formatter::operator<<(uint64_t const value)
+{
+    char_t string[NUMBER_SIZE];
+    int32_t const length( toDecimal(value, string) );
+    put(string, length);
+    return *this;
+}
+
+Formatter& Formatter::operator<<(Hex const value)
+{
+    char_t string[NUMBER_SIZE];
+    int32_t const length( toHexadecimal(value.value, value.digits, string) );
+    put(string, length);
+    return *this;
+}
+
+Formatter& Formatter::flush()
+{
+    if( length_ != 0 )
+    {
+        buffer_[length_] = '\0';
+        stream_ << buffer_;
+        static_cast<void>( stream_.flush() );
+        length_ = 0;
+    }
+    return *this;
+}
+
+Formatter::Hex Formatter::hex(uint32_t const value, int32_t const digits)
+{
+    Hex const res = { value, digits };
+    return res;
+}
+
+int32_t Formatter::toDecimal(uint32_t const value, char_t* const string)
+{
+    char_t digits[NUMBER_SIZE];
+    char_t* const end( &digits[NUMBER_SIZE] );
+    char_t* begin( NULLPTR );
+    if( value >= 1000000000U )
+    {
+        uint32_t const high( value / 1000000000U );
+        begin = convert(value - high * 1000000000U, end);
+        while( begin != end - LOW_DIGITS )
+        {
+            *--begin = '0';
+        }
+        *--begin = static_cast<char_t>('0' + high);
+    }
+    else
+    {
+        begin = convert(value, end);
+    }
+    int32_t const length( static_cast<int32_t>(end - begin) );
+    for(int32_t i(0); i<length; i++)
+    {
+        string[i] = begin[i];
+    }
+    return length;
+}
+
+int32_t Formatter::toDecimal(uint64_t value, char_t* const string)
+{
+    int32_t length( 0 );
+    if( (value >> 32) == 0U )
+    {
+        length = toDecimal(static_cast<uint32_t>(value), string);
+    }
+    else
+    {
+        int32_t const number( static_cast<int32_t>( sizeof(POWERS_OF_TEN) / sizeof(POWERS_OF_TEN[0]) ) );
+        for(int32_t i(0); i<number; i++)
+        {
+            char_t digit( '0' );
+            while( value >= POWERS_OF_TEN[i] )
+            {
+                value -= POWERS_OF_TEN[i];
+                digit++;
+            }
+            if( (length != 0) || (digit != '0') )
+            {
+                string[length++] = digit;
+            }
+        }
+        // The rest is less than 10^9, and it is put with leading zeros
+        char_t* const end( &string[length + LOW_DIGITS] );
+        char_t* begin( convert(static_cast<uint32_t>(value), end) );
+        while( begin != &string[length] )
+        {
+            *--begin = '0';
+        }
+        length += LOW_DIGITS;
+    }
+    return length;
+}
+
+int32_t Formatter::toHexadecimal(uint32_t value, int32_t digits, char_t* const string)
+{
+    if( digits < 1 )
+    {
+        digits = 1;
+    }
+    else if( digits > 8 )
+    {
+        digits = 8;
+    }
+    else
+    {
+    }
+    int32_t length( 8 );
+    while( (length > digits) && ((value >> ((length - 1) * 4)) == 0U) )
+    {
+        length--;
+    }
+    for(int32_t i(length - 1); i>=0; i--)
+    {
+        string[i] = HEX_DIGITS[value & 0xFU];
+        value >>= 4;
+    }
+    return length;
+}
+
+void Formatter::put(char_t const* const string, int32_t const length)
+{
+    for(int32_t i(0); i<length; i++)
+    {
+        if( length_ == BUFFER_SIZE )
+        {
+            static_cast<void>( flush() );
+        }
+        char_t const character( string[i] );
+        buffer_[length_++] = character;
+        if( character == '\n' )
+        {
+            static_cast<void>( flush() );
+        }
+    }
+}
+
+} // namespace pcb
+} // namespace eoos
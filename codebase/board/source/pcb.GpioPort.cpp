@@ -0,0 +1,65 @@
+/**
+ * @file      pcb.GpioPort.cpp
+ * @brief     EOOS port-wide GPIO access
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "pcb.GpioPort.hpp"
+#include "FreeRTOS.h"
+#include "task.h"
+
+namespace eoos
+{
+namespace pcb
+{
+namespace
+{
+
+/**
+ * @brief Address of RCC APB2 peripheral clock enable register.
+ */
+const uint32_t ADDRESS_RCC_APB2ENR( 0x40021018U );
+
+/**
+ * @brief APB2ENR bit of GPIO port A clock, next bits are of next ports.
+ */
+const uint32_t APB2ENR_IOPAEN( 0x00000004U );
+
+} // namespace
+
+GpioPort::GpioPort(Number const number)
+    : number_( number )
+    , reg_( getRegisters(number) ) {
+}
+
+void GpioPort::configure(uint32_t const mask, Mode const mode)
+{
+    uint32_t volatile& apb2enr( *reinterpret_cast<uint32_t volatile*>(ADDRESS_RCC_APB2ENR) );
+    taskENTER_CRITICAL();
+    apb2enr = apb2enr | (APB2ENR_IOPAEN << static_cast<uint32_t>(number_));
+    uint32_t crl( reg_.crl );
+    uint32_t crh( reg_.crh );
+    for(uint32_t pin(0U); pin < 16U; pin++)
+    {
+        if( (mask & (static_cast<uint32_t>(1) << pin)) != 0U )
+        {
+            uint32_t const shift( (pin & 0x7U) * 4U );
+            uint32_t const field( static_cast<uint32_t>(0xFU) << shift );
+            uint32_t const value( static_cast<uint32_t>(mode) << shift );
+            if( pin < 8U )
+            {
+                crl = (crl & ~field) | value;
+            }
+            else
+            {
+                crh = (crh & ~field) | value;
+            }
+        }
+    }
+    reg_.crl = crl;
+    reg_.crh = crh;
+    taskEXIT_CRITICAL();
+}
+
+} // namespace pcb
+} // namespace eoos
@@ -0,0 +1,63 @@
+/**
+ * @file      pcb.Job.cpp
+ * @brief     EOOS job of an executor
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "pcb.Job.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+Job::Job()
+    : notifier_( Notifier::TYPE_BINARY )
+    , isCompleted_( true ) {
+}
+
+Job::~Job()
+{
+}
+
+bool_t Job::isCompleted() const
+{
+    return isCompleted_;
+}
+
+bool_t Job::wait(int32_t const timeout)
+{
+    while( !isCompleted_ )
+    {
+        if( !notifier_.wait(timeout) )
+        {
+            break;
+        }
+    }
+    return isCompleted_;
+}
+
+bool_t Job::prepare()
+{
+    bool_t res( false );
+    if( isCompleted_ )
+    {
+        isCompleted_ = false;
+        notifier_.unbind();
+        res = notifier_.bind();
+    }
+    return res;
+}
+
+void Job::execute()
+{
+    run();
+    // Suspend the scheduler, so that the job is not touched after the waiting thread is resumed
+    vTaskSuspendAll();
+    isCompleted_ = true;
+    static_cast<void>( notifier_.notify() );
+    static_cast<void>( xTaskResumeAll() );
+}
+
+} // namespace pcb
+} // namespace eoos
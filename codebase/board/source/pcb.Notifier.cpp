@@ -0,0 +1,108 @@
+/**
+ * @file      pcb.Notifier.cpp
+ * @brief     EOOS direct to thread notifier
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "pcb.Notifier.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+Notifier::Notifier(Type const type)
+    : lib::NonCopyable<lib::NoAllocator>()
+    , task_( NULLPTR )
+    , type_( type ) {
+}
+
+Notifier::~Notifier()
+{
+    unbind();
+}
+
+bool_t Notifier::bind()
+{
+    bool_t res( false );
+    if( task_ == NULLPTR )
+    {
+        task_ = xTaskGetCurrentTaskHandle();
+        res = task_ != NULLPTR;
+    }
+    return res;
+}
+
+void Notifier::unbind()
+{
+    task_ = NULLPTR;
+}
+
+bool_t Notifier::isBound() const
+{
+    return task_ != NULLPTR;
+}
+
+bool_t Notifier::notify()
+{
+    bool_t res( false );
+    TaskHandle_t const task( task_ );
+    if( task != NULLPTR )
+    {
+        static_cast<void>( xTaskNotifyGive(task) );
+        res = true;
+    }
+    return res;
+}
+
+bool_t Notifier::notifyFromInterrupt()
+{
+    bool_t res( false );
+    TaskHandle_t const task( task_ );
+    if( task != NULLPTR )
+    {
+        BaseType_t isWoken( pdFALSE );
+        vTaskNotifyGiveFromISR(task, &isWoken);
+        portYIELD_FROM_ISR(isWoken);
+        res = true;
+    }
+    return res;
+}
+
+bool_t Notifier::wait(int32_t const timeout)
+{
+    bool_t res( false );
+    do
+    {
+        if( task_ == NULLPTR )
+        {
+            break;
+        }
+        if( xTaskGetCurrentTaskHandle() != task_ )
+        {
+            break;
+        }
+        TickType_t ticks( portMAX_DELAY );
+        if( timeout >= 0 )
+        {
+            ticks = pdMS_TO_TICKS( static_cast<TickType_t>(timeout) );
+        }
+        BaseType_t const isClear( (type_ == TYPE_BINARY) ? pdTRUE : pdFALSE );
+        res = ulTaskNotifyTake(isClear, ticks) != 0U;
+    } while(false);
+    return res;
+}
+
+bool_t Notifier::clear()
+{
+    bool_t res( false );
+    if( (task_ != NULLPTR) && (xTaskGetCurrentTaskHandle() == task_) )
+    {
+        static_cast<void>( ulTaskNotifyTake(pdTRUE, 0U) );
+        res = true;
+    }
+    return res;
+}
+
+} // namespace pcb
+} // namespace eoos
@@ -0,0 +1,250 @@
+/**
+ * @file      pcb.Nvic.cpp
+ * @brief     EOOS nested vectored interrupt controller
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "pcb.Nvic.hpp"
+#include "FreeRTOS.h"
+#include "task.h"
+
+namespace eoos
+{
+namespace pcb
+{
+namespace
+{
+
+/**
+ * @brief Number of system exceptions of Cortex-M3.
+ */
+const int32_t NUMBER_OF_EXCEPTIONS( 16 );
+
+/**
+ * @brief Number of entries of the vector table.
+ */
+const int32_t NUMBER_OF_VECTORS( NUMBER_OF_EXCEPTIONS + Nvic::NUMBER_OF_IRQS );
+
+/**
+ * @brief Address of Vector Table Offset Register.
+ */
+const uint32_t ADDRESS_SCB_VTOR( 0xE000ED08U );
+
+/**
+ * @brief Address of Interrupt Set-Enable Registers.
+ */
+const uint32_t ADDRESS_NVIC_ISER( 0xE000E100U );
+
+/**
+ * @brief Address of Interrupt Clear-Enable Registers.
+ */
+const uint32_t ADDRESS_NVIC_ICER( 0xE000E180U );
+
+/**
+ * @brief Address of Interrupt Set-Pending Registers.
+ */
+const uint32_t ADDRESS_NVIC_ISPR( 0xE000E200U );
+
+/**
+ * @brief Address of Interrupt Clear-Pending Registers.
+ */
+const uint32_t ADDRESS_NVIC_ICPR( 0xE000E280U );
+
+/**
+ * @brief Address of Interrupt Priority Registers.
+ */
+const uint32_t ADDRESS_NVIC_IPR( 0xE000E400U );
+
+/**
+ * @brief Vector table in SRAM.
+ *
+ * @note The table is aligned to the power of two of its size as VTOR requires.
+ */
+uint32_t vectors_[NUMBER_OF_VECTORS] __attribute__((aligned(512)));
+
+/**
+ * @brief Handler objects bound to interrupt requests.
+ */
+Handler* handlers_[Nvic::NUMBER_OF_IRQS];
+
+/**
+ * @brief Relocation flag.
+ */
+bool_t isRelocated_( false );
+
+/**
+ * @brief Returns a word register of an array of registers.
+ *
+ * @param address Address of the array.
+ * @param irq     Interrupt request number.
+ * @return The register.
+ */
+uint32_t volatile& getRegister(uint32_t const address, int32_t const irq)
+{
+    return *reinterpret_cast<uint32_t volatile*>(address + (static_cast<uint32_t>(irq) >> 5) * 4U);
+}
+
+/**
+ * @brief Returns a bit mask of an interrupt request in a word register.
+ *
+ * @param irq Interrupt request number.
+ * @return The mask.
+ */
+uint32_t getMask(int32_t const irq)
+{
+    return static_cast<uint32_t>(1) << (static_cast<uint32_t>(irq) & 0x1FU);
+}
+
+} // namespace
+
+bool_t Nvic::setHandler(int32_t const irq, Handler const handler)
+{
+    bool_t res( false );
+    if( isIrq(irq) && (handler != NULLPTR) )
+    {
+        taskENTER_CRITICAL();
+        if( !isRelocated_ )
+        {
+            relocate();
+        }
+        vectors_[NUMBER_OF_EXCEPTIONS + irq] = reinterpret_cast<uint32_t>(handler);
+        taskEXIT_CRITICAL();
+        res = true;
+    }
+    return res;
+}
+
+Nvic::Handler Nvic::getHandler(int32_t const irq)
+{
+    Handler res( NULLPTR );
+    if( isIrq(irq) )
+    {
+        uint32_t const* const vectors( reinterpret_cast<uint32_t const*>( *reinterpret_cast<uint32_t volatile*>(ADDRESS_SCB_VTOR) ) );
+        res = reinterpret_cast<Handler>( vectors[NUMBER_OF_EXCEPTIONS + irq] );
+    }
+    return res;
+}
+
+bool_t Nvic::bind(int32_t const irq, pcb::Handler& handler)
+{
+    bool_t res( false );
+    if( isIrq(irq) )
+    {
+        handlers_[irq] = &handler;
+        res = setHandler(irq, &Nvic::dispatch);
+    }
+    return res;
+}
+
+bool_t Nvic::setPriority(int32_t const irq, uint32_t const priority)
+{
+    bool_t res( false );
+    if( isIrq(irq) )
+    {
+        uint8_t volatile* const ipr( reinterpret_cast<uint8_t volatile*>(ADDRESS_NVIC_IPR) );
+        ipr[irq] = static_cast<uint8_t>(priority);
+        res = true;
+    }
+    return res;
+}
+
+uint32_t Nvic::getPriority(int32_t const irq)
+{
+    uint32_t res( 0U );
+    if( isIrq(irq) )
+    {
+        uint8_t volatile const* const ipr( reinterpret_cast<uint8_t volatile const*>(ADDRESS_NVIC_IPR) );
+        res = ipr[irq];
+    }
+    return res;
+}
+
+bool_t Nvic::enable(int32_t const irq)
+{
+    bool_t res( false );
+    if( isIrq(irq) )
+    {
+        getRegister(ADDRESS_NVIC_ISER, irq) = getMask(irq);
+        res = true;
+    }
+    return res;
+}
+
+bool_t Nvic::disable(int32_t const irq)
+{
+    bool_t res( false );
+    if( isIrq(irq) )
+    {
+        getRegister(ADDRESS_NVIC_ICER, irq) = getMask(irq);
+        res = true;
+    }
+    return res;
+}
+
+bool_t Nvic::isEnabled(int32_t const irq)
+{
+    bool_t res( false );
+    if( isIrq(irq) )
+    {
+        res = (getRegister(ADDRESS_NVIC_ISER, irq) & getMask(irq)) != 0U;
+    }
+    return res;
+}
+
+bool_t Nvic::clearPending(int32_t const irq)
+{
+    bool_t res( false );
+    if( isIrq(irq) )
+    {
+        getRegister(ADDRESS_NVIC_ICPR, irq) = getMask(irq);
+        res = true;
+    }
+    return res;
+}
+
+bool_t Nvic::setPending(int32_t const irq)
+{
+    bool_t res( false );
+    if( isIrq(irq) )
+    {
+        getRegister(ADDRESS_NVIC_ISPR, irq) = getMask(irq);
+        res = true;
+    }
+    return res;
+}
+
+void Nvic::relocate()
+{
+    uint32_t volatile& vtor( *reinterpret_cast<uint32_t volatile*>(ADDRESS_SCB_VTOR) );
+    uint32_t const* const source( reinterpret_cast<uint32_t const*>(vtor) );
+    for(int32_t i(0); i<NUMBER_OF_VECTORS; i++)
+    {
+        vectors_[i] = source[i];
+    }
+    vtor = reinterpret_cast<uint32_t>(&vectors_[0]);
+    __asm volatile ("dsb\n\tisb" : : : "memory");
+    isRelocated_ = true;
+}
+
+void Nvic::dispatch()
+{
+    uint32_t ipsr;
+    __asm volatile ("mrs %0, ipsr" : "=r" (ipsr));
+    int32_t const irq( static_cast<int32_t>(ipsr & 0x1FFU) - NUMBER_OF_EXCEPTIONS );
+    if( isIrq(irq) )
+    {
+        pcb::Handler* const handler( handlers_[irq] );
+        if( handler != NULLPTR )
+        {
+            handler->handle();
+        }
+    }
+}
+
+bool_t Nvic::isIrq(int32_t const irq)
+{
+    return (irq >= 0) && (irq < NUMBER_OF_IRQS);
+}
+
+} // namespace pcb
+} // namespace eoos
@@ -0,0 +1,171 @@
+/**
+ * @file      pcb.PeriodicScheduler.cpp
+ * @brief     EOOS rate-monotonic scheduler of periodic tasks
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "pcb.PeriodicScheduler.hpp"
+#include "pcb.Clock.hpp"
+#include "api.Thread.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+PeriodicScheduler::PeriodicScheduler()
+    : lib::NonCopyable<lib::NoAllocator>()
+    , tasks_( NULLPTR )
+    , isStarted_( false ) {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+PeriodicScheduler::~PeriodicScheduler()
+{
+    stop();
+}
+
+bool_t PeriodicScheduler::add(PeriodicTask& task)
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() || isStarted_ )
+        {
+            break;
+        }
+        if( !task.isConstructed() )
+        {
+            break;
+        }
+        bool_t isAdded( false );
+        for(PeriodicTask* t( tasks_ ); t != NULLPTR; t = t->next_)
+        {
+            if( t == &task )
+            {
+                isAdded = true;
+            }
+        }
+        if( isAdded )
+        {
+            break;
+        }
+        // Keep rate-monotonic order, and deadline-monotonic order on equal periods
+        PeriodicTask** link( &tasks_ );
+        while( *link != NULLPTR )
+        {
+            PeriodicTask* const t( *link );
+            if( (task.getPeriod() < t->getPeriod()) || ((task.getPeriod() == t->getPeriod()) && (task.getDeadline() < t->getDeadline())) )
+            {
+                break;
+            }
+            link = &t->next_;
+        }
+        task.next_ = *link;
+        *link = &task;
+        res = true;
+    } while(false);
+    return res;
+}
+
+bool_t PeriodicScheduler::isSchedulable() const
+{
+    bool_t res( isConstructed() );
+    for(PeriodicTask const* task( tasks_ ); res && (task != NULLPTR); task = task->next_)
+    {
+        res = getResponse(*task) <= task->getDeadline();
+    }
+    return res;
+}
+
+bool_t PeriodicScheduler::start()
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() || isStarted_ )
+        {
+            break;
+        }
+        if( (tasks_ == NULLPTR) || !isSchedulable() )
+        {
+            break;
+        }
+        int32_t priority( api::Thread::PRIORITY_MAX );
+        uint64_t const release( Clock::getCycles() + Clock::toCycles( static_cast<uint64_t>(DELAY) * 1000U ) );
+        for(PeriodicTask* task( tasks_ ); task != NULLPTR; task = task->next_)
+        {
+            static_cast<void>( task->setPriority(priority) );
+            if( priority > api::Thread::PRIORITY_MIN )
+            {
+                priority--;
+            }
+            task->release_ = release;
+            task->isStopped_ = false;
+        }
+        res = true;
+        for(PeriodicTask* task( tasks_ ); task != NULLPTR; task = task->next_)
+        {
+            res = task->execute() && res;
+        }
+        isStarted_ = true;
+    } while(false);
+    return res;
+}
+
+void PeriodicScheduler::stop()
+{
+    if( isStarted_ )
+    {
+        for(PeriodicTask* task( tasks_ ); task != NULLPTR; task = task->next_)
+        {
+            task->stop();
+        }
+        for(PeriodicTask* task( tasks_ ); task != NULLPTR; task = task->next_)
+        {
+            static_cast<void>( task->join() );
+        }
+        isStarted_ = false;
+    }
+}
+
+int32_t PeriodicScheduler::getUtilization() const
+{
+    uint64_t utilization( 0U );
+    for(PeriodicTask const* task( tasks_ ); task != NULLPTR; task = task->next_)
+    {
+        utilization += (task->getWcet() * 10000U) / task->getPeriod();
+    }
+    return static_cast<int32_t>(utilization / 100U);
+}
+
+bool_t PeriodicScheduler::construct()
+{
+    return isConstructed();
+}
+
+uint64_t PeriodicScheduler::getResponse(PeriodicTask const& task) const
+{
+    uint64_t const wcet( task.getWcet() );
+    uint64_t response( wcet );
+    uint64_t previous( 0U );
+    // Iterate R = C + sum(ceil(R / Tj) * Cj) of the higher priority tasks until it converges
+    while( (response != previous) && (response <= task.getDeadline()) )
+    {
+        previous = response;
+        response = wcet;
+        for(PeriodicTask const* t( tasks_ ); (t != NULLPTR) && (t != &task); t = t->next_)
+        {
+            response += ((previous + t->getPeriod() - 1U) / t->getPeriod()) * t->getWcet();
+        }
+    }
+    if( response > task.getDeadline() )
+    {
+        response = task.getDeadline() + 1U;
+    }
+    return response;
+}
+
+} // namespace pcb
+} // namespace eoos
@@ -0,0 +1,141 @@
+/**
+ * @file      pcb.PeriodicTask.cpp
+ * @brief     EOOS periodic task
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "pcb.PeriodicTask.hpp"
+#include "pcb.Clock.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+PeriodicTask::PeriodicTask(int32_t const period, int32_t const deadline, int32_t const wcet)
+    : Parent()
+    , period_( 0U )
+    , deadline_( 0U )
+    , wcet_( 0U )
+    , response_( 0U )
+    , release_( 0U )
+    , jobs_( 0U )
+    , misses_( 0U )
+    , overruns_( 0U )
+    , histogram_()
+    , isStopped_( false )
+    , next_( NULLPTR ) {
+    bool_t const isConstructed( construct(period, deadline, wcet) );
+    setConstructed( isConstructed );
+}
+
+PeriodicTask::~PeriodicTask()
+{
+}
+
+void PeriodicTask::stop()
+{
+    isStopped_ = true;
+}
+
+uint64_t PeriodicTask::getPeriod() const
+{
+    return period_;
+}
+
+uint64_t PeriodicTask::getDeadline() const
+{
+    return deadline_;
+}
+
+uint64_t PeriodicTask::getWcet() const
+{
+    return wcet_;
+}
+
+uint32_t PeriodicTask::getJobs() const
+{
+    return jobs_;
+}
+
+uint32_t PeriodicTask::getMisses() const
+{
+    return misses_;
+}
+
+uint32_t PeriodicTask::getOverruns() const
+{
+    return overruns_;
+}
+
+uint64_t PeriodicTask::getResponse() const
+{
+    return response_;
+}
+
+uint32_t PeriodicTask::getHistogram(int32_t const bin) const
+{
+    uint32_t res( 0U );
+    if( (bin >= 0) && (bin < NUMBER_OF_BINS) )
+    {
+        res = histogram_[bin];
+    }
+    return res;
+}
+
+void PeriodicTask::start()
+{
+    while( !isStopped_ )
+    {
+        Clock::sleepUntil(release_);
+        uint64_t const start( Clock::getCycles() );
+        run();
+        uint64_t const finish( Clock::getCycles() );
+        account(finish - start, finish - release_);
+        release_ += period_;
+    }
+}
+
+bool_t PeriodicTask::construct(int32_t const period, int32_t const deadline, int32_t const wcet)
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {
+            break;
+        }
+        if( (period <= 0) || (deadline <= 0) || (deadline > period) || (wcet < 0) || (wcet > deadline) )
+        {
+            break;
+        }
+        period_ = Clock::toCycles( static_cast<uint64_t>(period) * 1000U );
+        deadline_ = Clock::toCycles( static_cast<uint64_t>(deadline) * 1000U );
+        wcet_ = Clock::toCycles( static_cast<uint64_t>(wcet) * 1000U );
+        res = true;
+    } while(false);
+    return res;
+}
+
+void PeriodicTask::account(uint64_t const time, uint64_t const response)
+{
+    response_ = (response > response_) ? response : response_;
+    if( response > deadline_ )
+    {
+        misses_++;
+    }
+    if( time > wcet_ )
+    {
+        overruns_++;
+    }
+    uint64_t bin( (response * 8U) / deadline_ );
+    if( bin >= static_cast<uint64_t>(NUMBER_OF_BINS) )
+    {
+        bin = NUMBER_OF_BINS - 1;
+    }
+    histogram_[bin]++;
+    jobs_++;
+}
+
+} // namespace pcb
+} // namespace eoos
@@ -0,0 +1,85 @@
+/**
+ * @file      pcb.Runtime.cpp
+ * @brief     EOOS C++ run-time support of the minimal build profile
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * The minimal build profile is compiled without C++ exceptions and RTTI. The run-time
+ * functions below replace ones of the C++ support library, which would link
+ * std::terminate, the stack unwinder and their exception handling tables.
+ * The profile is enabled by EOOS_PCB_ENABLE_MINIMAL_RUNTIME definition.
+ */
+#include "Types.hpp"
+
+#if defined (EOOS_PCB_ENABLE_MINIMAL_RUNTIME)
+
+#if defined (__EXCEPTIONS) || defined (__GXX_RTTI)
+    #error "Minimal build profile must be compiled without C++ exceptions and RTTI"
+#endif
+
+extern "C"
+{
+
+/**
+ * @brief DSO handle of the firmware.
+ */
+void* __dso_handle( NULLPTR );
+
+/**
+ * @brief Handles a call of a pure virtual function.
+ *
+ * The call is a program error, and the function won't return.
+ */
+void __cxa_pure_virtual(void)
+{
+    while(true){}
+}
+
+/**
+ * @brief Handles a call of a deleted virtual function.
+ *
+ * The call is a program error, and the function won't return.
+ */
+void __cxa_deleted_virtual(void)
+{
+    while(true){}
+}
+
+/**
+ * @brief Registers a destructor of a static object.
+ *
+ * The firmware never exits, so static objects are never destroyed
+ * and the destructors are not registered.
+ *
+ * @param object     Static object.
+ * @param destructor Destructor of the object.
+ * @param dso        DSO handle.
+ * @return Zero as success.
+ */
+int __aeabi_atexit(void* object, void (*destructor)(void*), void* dso)
+{
+    static_cast<void>(object);
+    static_cast<void>(destructor);
+    static_cast<void>(dso);
+    return 0;
+}
+
+/**
+ * @brief Registers a destructor of a static object.
+ *
+ * @param destructor Destructor of the object.
+ * @param object     Static object.
+ * @param dso        DSO handle.
+ * @return Zero as success.
+ */
+int __cxa_atexit(void (*destructor)(void*), void* object, void* dso)
+{
+    static_cast<void>(object);
+    static_cast<void>(destructor);
+    static_cast<void>(dso);
+    return 0;
+}
+
+} // extern "C"
+
+#endif // EOOS_PCB_ENABLE_MINIMAL_RUNTIME
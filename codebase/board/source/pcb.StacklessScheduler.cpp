@@ -0,0 +1,175 @@
+/**
+ * @file      pcb.StacklessScheduler.cpp
+ * @brief     EOOS scheduler of stackless tasks
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "pcb.StacklessScheduler.hpp"
+#include "FreeRTOS.h"
+#include "task.h"
+
+namespace eoos
+{
+namespace pcb
+{
+
+StacklessScheduler::StacklessScheduler()
+    : lib::NonCopyable<lib::NoAllocator>()
+    , group_()
+    , tasks_( NULLPTR )
+    , pending_( 0U ) {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+StacklessScheduler::~StacklessScheduler()
+{
+}
+
+bool_t StacklessScheduler::add(StacklessTask& task)
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {
+            break;
+        }
+        StacklessTask** link( &tasks_ );
+        while( *link != NULLPTR )
+        {
+            if( *link == &task )
+            {
+                break;
+            }
+            link = &(*link)->next_;
+        }
+        if( *link != NULLPTR )
+        {   // The task has already been added
+            break;
+        }
+        task.next_ = NULLPTR;
+        *link = &task;
+        res = true;
+    } while(false);
+    return res;
+}
+
+bool_t StacklessScheduler::run()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        while( tasks_ != NULLPTR )
+        {
+            pending_ |= group_.clearBits(EventGroup::BITS_MASK);
+            uint32_t const time( static_cast<uint32_t>( xTaskGetTickCount() ) );
+            bool_t isResumed( false );
+            StacklessTask** link( &tasks_ );
+            while( *link != NULLPTR )
+            {
+                StacklessTask* const task( *link );
+                StacklessTask::Status status( StacklessTask::STATUS_WAITING );
+                if( isReady(*task, time) )
+                {
+                    isResumed = true;
+                    status = task->run();
+                }
+                if( status == StacklessTask::STATUS_EXITED )
+                {
+                    *link = task->next_;
+                    task->next_ = NULLPTR;
+                }
+                else
+                {
+                    link = &task->next_;
+                }
+            }
+            if( !isResumed )
+            {
+                static_cast<void>( group_.waitAny(EventGroup::BITS_MASK, getTimeout(time), false) );
+            }
+        }
+        res = true;
+    }
+    return res;
+}
+
+EventGroup& StacklessScheduler::getEventGroup()
+{
+    return group_;
+}
+
+bool_t StacklessScheduler::construct()
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {
+            break;
+        }
+        if( !group_.isConstructed() )
+        {
+            break;
+        }
+        res = true;
+    } while(false);
+    return res;
+}
+
+bool_t StacklessScheduler::isReady(StacklessTask& task, uint32_t const time)
+{
+    bool_t const isExpired( task.isTimed_ && (static_cast<int32_t>(time - task.wakeTime_) >= 0) );
+    bool_t res( false );
+    if( task.waitBits_ != 0U )
+    {
+        uint32_t const bits( pending_ & task.waitBits_ );
+        if( (bits != 0U) || isExpired )
+        {
+            pending_ &= ~bits;
+            task.bits_ = bits;
+            task.waitBits_ = 0U;
+            task.isTimed_ = false;
+            res = true;
+        }
+    }
+    else if( task.isTimed_ )
+    {
+        if( isExpired )
+        {
+            task.isTimed_ = false;
+            res = true;
+        }
+    }
+    else
+    {
+        res = true;
+    }
+    return res;
+}
+
+int32_t StacklessScheduler::getTimeout(uint32_t const time) const
+{
+    int32_t timeout( EventGroup::TIMEOUT_INFINITE );
+    for(StacklessTask const* task( tasks_ ); task != NULLPTR; task = task->next_)
+    {
+        if( task->isTimed_ )
+        {
+            int32_t ticks( static_cast<int32_t>(task->wakeTime_ - time) );
+            if( ticks < 0 )
+            {
+                ticks = 0;
+            }
+            int32_t const ms( ticks * static_cast<int32_t>(portTICK_PERIOD_MS) );
+            if( (timeout == EventGroup::TIMEOUT_INFINITE) || (ms < timeout) )
+            {
+                timeout = ms;
+            }
+        }
+    }
+    return timeout;
+}
+
+} // namespace pcb
+} // namespace eoos
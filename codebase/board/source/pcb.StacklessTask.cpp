@@ -0,0 +1,71 @@
+/**
+ * @file      pcb.StacklessTask.cpp
+ * @brief     EOOS stackless task
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "pcb.StacklessTask.hpp"
+#include "pcb.EventGroup.hpp"
+#include "FreeRTOS.h"
+#include "task.h"
+
+namespace eoos
+{
+namespace pcb
+{
+
+StacklessTask::StacklessTask()
+    : line_( 0 )
+    , isTimed_( false )
+    , wakeTime_( 0U )
+    , waitBits_( 0U )
+    , bits_( 0U )
+    , next_( NULLPTR ) {
+}
+
+StacklessTask::~StacklessTask()
+{
+}
+
+int32_t StacklessTask::getLine() const
+{
+    return line_;
+}
+
+void StacklessTask::setLine(int32_t const line)
+{
+    line_ = line;
+}
+
+void StacklessTask::sleepFor(int32_t const time)
+{
+    TickType_t const ticks( (time > 0) ? pdMS_TO_TICKS( static_cast<TickType_t>(time) ) : 0U );
+    wakeTime_ = static_cast<uint32_t>( xTaskGetTickCount() + ticks );
+    isTimed_ = true;
+    waitBits_ = 0U;
+    bits_ = 0U;
+}
+
+void StacklessTask::waitFor(uint32_t const bits, int32_t const timeout)
+{
+    if( timeout >= 0 )
+    {
+        TickType_t const ticks( pdMS_TO_TICKS( static_cast<TickType_t>(timeout) ) );
+        wakeTime_ = static_cast<uint32_t>( xTaskGetTickCount() + ticks );
+        isTimed_ = true;
+    }
+    else
+    {
+        isTimed_ = false;
+    }
+    waitBits_ = bits & EventGroup::BITS_MASK;
+    bits_ = 0U;
+}
+
+uint32_t StacklessTask::getBits() const
+{
+    return bits_;
+}
+
+} // namespace pcb
+} // namespace eoos
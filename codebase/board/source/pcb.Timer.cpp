@@ -0,0 +1,159 @@
+/**
+ * @file      pcb.Timer.cpp
+ * @brief     EOOS software timer
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "pcb.Timer.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+Timer::Timer(Handler& handler, Mode const mode, int32_t const period)
+    : lib::NonCopyable<lib::NoAllocator>()
+    , handler_( handler )
+    , buffer_()
+    , handle_( NULLPTR ) {
+    bool_t const isConstructed( construct(mode, period) );
+    setConstructed( isConstructed );
+}
+
+Timer::~Timer()
+{
+    if( handle_ != NULLPTR )
+    {
+        static_cast<void>( xTimerDelete(handle_, portMAX_DELAY) );
+        // The timer service task handles the commands in order, so the buffer
+        // is released when a function pended after the delete command is called
+        StaticSemaphore_t buffer;
+        SemaphoreHandle_t const semaphore( xSemaphoreCreateBinaryStatic(&buffer) );
+        if( xTimerPendFunctionCall(&Timer::release, semaphore, 0U, portMAX_DELAY) == pdPASS )
+        {
+            static_cast<void>( xSemaphoreTake(semaphore, portMAX_DELAY) );
+        }
+        vSemaphoreDelete(semaphore);
+    }
+}
+
+bool_t Timer::start()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        res = xTimerStart(handle_, portMAX_DELAY) == pdPASS;
+    }
+    return res;
+}
+
+bool_t Timer::stop()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        res = xTimerStop(handle_, portMAX_DELAY) == pdPASS;
+    }
+    return res;
+}
+
+bool_t Timer::startFromInterrupt()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        BaseType_t isWoken( pdFALSE );
+        res = xTimerStartFromISR(handle_, &isWoken) == pdPASS;
+        portYIELD_FROM_ISR(isWoken);
+    }
+    return res;
+}
+
+bool_t Timer::stopFromInterrupt()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        BaseType_t isWoken( pdFALSE );
+        res = xTimerStopFromISR(handle_, &isWoken) == pdPASS;
+        portYIELD_FROM_ISR(isWoken);
+    }
+    return res;
+}
+
+bool_t Timer::setPeriod(int32_t const period)
+{
+    bool_t res( false );
+    TickType_t const ticks( toTicks(period) );
+    if( isConstructed() && (ticks != 0U) )
+    {
+        res = xTimerChangePeriod(handle_, ticks, portMAX_DELAY) == pdPASS;
+    }
+    return res;
+}
+
+bool_t Timer::isActive() const
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        res = xTimerIsTimerActive(handle_) != pdFALSE;
+    }
+    return res;
+}
+
+bool_t Timer::construct(Mode const mode, int32_t const period)
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {
+            break;
+        }
+        TickType_t const ticks( toTicks(period) );
+        if( ticks == 0U )
+        {
+            break;
+        }
+        UBaseType_t const isReload( (mode == MODE_PERIODIC) ? pdTRUE : pdFALSE );
+        handle_ = xTimerCreateStatic("EOOS", ticks, isReload, this, &Timer::callback, &buffer_);
+        if( handle_ == NULLPTR )
+        {
+            break;
+        }
+        res = true;
+    } while(false);
+    return res;
+}
+
+TickType_t Timer::toTicks(int32_t const period)
+{
+    TickType_t ticks( 0U );
+    if( period > 0 )
+    {
+        ticks = pdMS_TO_TICKS( static_cast<TickType_t>(period) );
+        if( ticks == 0U )
+        {
+            ticks = 1U;
+        }
+    }
+    return ticks;
+}
+
+void Timer::callback(TimerHandle_t const timer)
+{
+    Timer* const self( static_cast<Timer*>( pvTimerGetTimerID(timer) ) );
+    if( self != NULLPTR )
+    {
+        self->handler_.handle();
+    }
+}
+
+void Timer::release(void* const semaphore, uint32_t)
+{
+    static_cast<void>( xSemaphoreGive( static_cast<SemaphoreHandle_t>(semaphore) ) );
+}
+
+} // namespace pcb
+} // namespace eoos
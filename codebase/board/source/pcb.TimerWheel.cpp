@@ -0,0 +1,193 @@
+/**
+ * @file      pcb.TimerWheel.cpp
+ * @brief     EOOS hierarchical timer wheel
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "pcb.TimerWheel.hpp"
+#include "FreeRTOS.h"
+#include "task.h"
+
+namespace eoos
+{
+namespace pcb
+{
+
+TimerWheel::Entry::Entry(Handler& handler)
+    : node_()
+    , handler_( &handler )
+    , expiry_( 0U )
+    , period_( 0U )
+    , isActive_( false ) {
+    node_.prev = &node_;
+    node_.next = &node_;
+}
+
+bool_t TimerWheel::Entry::isActive() const
+{
+    return isActive_;
+}
+
+TimerWheel::TimerWheel()
+    : lib::NonCopyable<lib::NoAllocator>()
+    , slots_()
+    , time_( 0U ) {
+    for(int32_t level(0); level < LEVELS; level++)
+    {
+        for(int32_t slot(0); slot < SLOTS; slot++)
+        {
+            initialize( slots_[level][slot] );
+        }
+    }
+}
+
+TimerWheel::~TimerWheel()
+{
+}
+
+bool_t TimerWheel::start(Entry& entry, uint32_t const delay, uint32_t const period)
+{
+    bool_t res( false );
+    if( isConstructed() && (delay != 0U) && (delay <= MAXIMUM_DELAY) && (period <= MAXIMUM_DELAY) )
+    {
+        taskENTER_CRITICAL();
+        if( entry.isActive_ )
+        {
+            unlink(entry.node_);
+        }
+        entry.expiry_ = time_ + delay;
+        entry.period_ = period;
+        entry.isActive_ = true;
+        insert(entry);
+        taskEXIT_CRITICAL();
+        res = true;
+    }
+    return res;
+}
+
+bool_t TimerWheel::stop(Entry& entry)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        taskENTER_CRITICAL();
+        if( entry.isActive_ )
+        {
+            unlink(entry.node_);
+            entry.isActive_ = false;
+        }
+        taskEXIT_CRITICAL();
+        res = true;
+    }
+    return res;
+}
+
+void TimerWheel::tick()
+{
+    if( isConstructed() )
+    {
+        Node expired;
+        initialize(expired);
+        taskENTER_CRITICAL();
+        time_++;
+        uint32_t const index( time_ & SLOT_MASK );
+        // Cascade the upper levels each time a lower level has made a full turn
+        int32_t level( 1 );
+        while( (level < LEVELS) && ((time_ & ((static_cast<uint32_t>(1) << (SLOT_BITS * level)) - 1U)) == 0U) )
+        {
+            cascade(level);
+            level++;
+        }
+        move(slots_[0][index], expired);
+        while( expired.next != &expired )
+        {
+            Entry& entry( *reinterpret_cast<Entry*>(expired.next) );
+            unlink(entry.node_);
+            if( entry.period_ != 0U )
+            {
+                entry.expiry_ += entry.period_;
+                insert(entry);
+            }
+            else
+            {
+                entry.isActive_ = false;
+            }
+            Handler* const handler( entry.handler_ );
+            // Call the handler out of the critical section, so that it may start and stop timers
+            taskEXIT_CRITICAL();
+            handler->handle();
+            taskENTER_CRITICAL();
+        }
+        taskEXIT_CRITICAL();
+    }
+}
+
+uint32_t TimerWheel::getTime() const
+{
+    return time_;
+}
+
+void TimerWheel::insert(Entry& entry)
+{
+    uint32_t const expiry( entry.expiry_ );
+    uint32_t const delta( expiry - time_ );
+    int32_t level( 0 );
+    // Find the lowest level, which covers the delta
+    while( (level < (LEVELS - 1)) && (delta >= (static_cast<uint32_t>(1) << (SLOT_BITS * (level + 1)))) )
+    {
+        level++;
+    }
+    uint32_t const index( (expiry >> (SLOT_BITS * level)) & SLOT_MASK );
+    link(slots_[level][index], entry.node_);
+}
+
+void TimerWheel::cascade(int32_t const level)
+{
+    uint32_t const index( (time_ >> (SLOT_BITS * level)) & SLOT_MASK );
+    Node list;
+    initialize(list);
+    move(slots_[level][index], list);
+    while( list.next != &list )
+    {
+        Entry& entry( *reinterpret_cast<Entry*>(list.next) );
+        unlink(entry.node_);
+        insert(entry);
+    }
+}
+
+void TimerWheel::initialize(Node& list)
+{
+    list.prev = &list;
+    list.next = &list;
+}
+
+void TimerWheel::link(Node& list, Node& node)
+{
+    node.prev = list.prev;
+    node.next = &list;
+    list.prev->next = &node;
+    list.prev = &node;
+}
+
+void TimerWheel::unlink(Node& node)
+{
+    node.prev->next = node.next;
+    node.next->prev = node.prev;
+    node.prev = &node;
+    node.next = &node;
+}
+
+void TimerWheel::move(Node& from, Node& to)
+{
+    if( from.next != &from )
+    {
+        to.next = from.next;
+        to.prev = from.prev;
+        to.next->prev = &to;
+        to.prev->next = &to;
+        initialize(from);
+    }
+}
+
+} // namespace pcb
+} // namespace eoos
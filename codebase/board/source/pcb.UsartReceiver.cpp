@@ -0,0 +1,227 @@
+/**
+ * @file      pcb.UsartReceiver.cpp
+ * @brief     EOOS line receiver of a USART
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "pcb.UsartReceiver.hpp"
+#include "pcb.Clock.hpp"
+#include "pcb.CriticalSection.hpp"
+#include "FreeRTOS.h"
+
+namespace eoos
+{
+namespace pcb
+{
+namespace
+{
+
+/**
+ * @brief Addresses of USART registers.
+ */
+const uint32_t ADDRESS_USART[3] = { 0x40013800U, 0x40004400U, 0x40004800U };
+
+const uint32_t SR_RXNE( 0x00000020U ); ///< Read data register not empty.
+const uint32_t SR_ORE( 0x00000008U );  ///< Overrun error.
+const uint32_t CR1_RE( 0x00000004U );  ///< Receiver enable.
+const uint32_t CR1_RXNEIE( 0x00000020U ); ///< Read data register not empty interrupt enable.
+
+const char_t CHAR_CR( '\r' );          ///< Carriage return.
+const char_t CHAR_LF( '\n' );          ///< Line feed.
+
+} // namespace
+
+UsartReceiver* UsartReceiver::receivers_[NUMBER_OF_USARTS] = { NULLPTR };
+
+UsartReceiver::UsartReceiver(Number const number, Notifier& notifier)
+    : lib::NonCopyable<lib::NoAllocator>()
+    , number_( number )
+    , reg_( *reinterpret_cast<Registers*>(ADDRESS_USART[number]) )
+    , notifier_( notifier )
+    , handler_( NULLPTR )
+    , priority_( 0U )
+    , isIrqEnabled_( false )
+    , isEnabled_( (reg_.cr1 & CR1_RE) != 0U )
+    , isCarriageReturn_( false ) {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+UsartReceiver::~UsartReceiver()
+{
+    if( receivers_[number_] == this )
+    {
+        int32_t const irq( Nvic::IRQ_USART1 + static_cast<int32_t>(number_) );
+        setInterrupt(false);
+        static_cast<void>( Nvic::disable(irq) );
+        static_cast<void>( Nvic::setHandler(irq, handler_) );
+        static_cast<void>( Nvic::setPriority(irq, priority_) );
+        static_cast<void>( Nvic::clearPending(irq) );
+        if( isIrqEnabled_ )
+        {
+            static_cast<void>( Nvic::enable(irq) );
+        }
+        receivers_[number_] = NULLPTR;
+        if( !isEnabled_ )
+        {
+            CriticalSection const section;
+            reg_.cr1 = reg_.cr1 & ~CR1_RE;
+        }
+    }
+}
+
+int32_t UsartReceiver::readLine(char_t* const line, int32_t const size, int32_t const timeout)
+{
+    int32_t res( -1 );
+    int32_t length( 0 );
+    if( isConstructed() && notifier_.isBound() )
+    {
+        uint64_t const start( Clock::getCycles() );
+        uint64_t const cycles( Clock::toCycles( static_cast<uint64_t>(timeout) * 1000000U ) );
+        while( res < 0 )
+        {
+            if( (reg_.sr & (SR_RXNE | SR_ORE)) == 0U )
+            {
+                int32_t wait( Notifier::TIMEOUT_INFINITE );
+                if( timeout != TIMEOUT_INFINITE )
+                {
+                    uint64_t const passed( Clock::getCycles() - start );
+                    if( passed >= cycles )
+                    {
+                        break;
+                    }
+                    // The rest is rounded up to milliseconds not to wake before the timeout
+                    wait = static_cast<int32_t>( (Clock::toNanoseconds(cycles - passed) + 999999U) / 1000000U );
+                }
+                // A character received before the enabling raises the interrupt at once
+                setInterrupt(true);
+                static_cast<void>( notifier_.wait(wait) );
+                continue;
+            }
+            char_t const ch( static_cast<char_t>(reg_.dr & 0xFFU) );
+            bool_t const isLineFeedOfCrLf( isCarriageReturn_ && (ch == CHAR_LF) );
+            isCarriageReturn_ = ch == CHAR_CR;
+            if( isLineFeedOfCrLf )
+            {
+                continue;
+            }
+            if( (ch == CHAR_CR) || (ch == CHAR_LF) )
+            {
+                res = length;
+            }
+            else if( length < size - 1 )
+            {
+                line[length++] = ch;
+            }
+            else
+            {
+                // The character is lost
+            }
+        }
+        // The interrupt is disabled first not to notify the thread after the dropping
+        setInterrupt(false);
+        static_cast<void>( notifier_.clear() );
+    }
+    if( size > 0 )
+    {
+        line[length] = '\0';
+    }
+    return res;
+}
+
+bool_t UsartReceiver::construct()
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {
+            break;
+        }
+        if( receivers_[number_] != NULLPTR )
+        {
+            break;
+        }
+        if( !isEnabled_ )
+        {
+            CriticalSection const section;
+            reg_.cr1 = reg_.cr1 | CR1_RE;
+        }
+        // Drop a character and an overrun received before the constructor call
+        while( (reg_.sr & (SR_RXNE | SR_ORE)) != 0U )
+        {
+            static_cast<void>( reg_.dr );
+        }
+        int32_t const irq( Nvic::IRQ_USART1 + static_cast<int32_t>(number_) );
+        handler_ = Nvic::getHandler(irq);
+        priority_ = Nvic::getPriority(irq);
+        isIrqEnabled_ = Nvic::isEnabled(irq);
+        Nvic::Handler handler( NULLPTR );
+        switch( number_ )
+        {
+            case NUMBER_USART1: handler = &UsartReceiver::handleUsart1; break;
+            case NUMBER_USART2: handler = &UsartReceiver::handleUsart2; break;
+            case NUMBER_USART3: handler = &UsartReceiver::handleUsart3; break;
+            default: break;
+        }
+        receivers_[number_] = this;
+        if( !Nvic::setHandler(irq, handler) )
+        {
+            receivers_[number_] = NULLPTR;
+            if( !isEnabled_ )
+            {
+                CriticalSection const section;
+                reg_.cr1 = reg_.cr1 & ~CR1_RE;
+            }
+            break;
+        }
+        static_cast<void>( Nvic::setPriority(irq, configMAX_SYSCALL_INTERRUPT_PRIORITY) );
+        static_cast<void>( Nvic::enable(irq) );
+        res = true;
+    } while(false);
+    return res;
+}
+
+void UsartReceiver::setInterrupt(bool_t const isEnabled)
+{
+    // The register is shared with the driver and the interrupt
+    CriticalSection const section;
+    reg_.cr1 = isEnabled ? (reg_.cr1 | CR1_RXNEIE) : (reg_.cr1 & ~CR1_RXNEIE);
+}
+
+void UsartReceiver::handle(int32_t const number)
+{
+    UsartReceiver* const receiver( receivers_[number] );
+    if( receiver != NULLPTR )
+    {
+        Registers& reg( receiver->reg_ );
+        if( ((reg.cr1 & CR1_RXNEIE) != 0U) && ((reg.sr & (SR_RXNE | SR_ORE)) != 0U) )
+        {
+            // The character is read by the thread, and the interrupt is enabled by its next wait
+            reg.cr1 = reg.cr1 & ~CR1_RXNEIE;
+            static_cast<void>( receiver->notifier_.notifyFromInterrupt() );
+        }
+        if( receiver->isIrqEnabled_ )
+        {
+            receiver->handler_();
+        }
+    }
+}
+
+void UsartReceiver::handleUsart1()
+{
+    handle(NUMBER_USART1);
+}
+
+void UsartReceiver::handleUsart2()
+{
+    handle(NUMBER_USART2);
+}
+
+void UsartReceiver::handleUsart3()
+{
+    handle(NUMBER_USART3);
+}
+
+} // namespace pcb
+} // namespace eoos
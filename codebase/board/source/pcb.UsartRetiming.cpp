@@ -0,0 +1,95 @@
+/**
+ * @file      pcb.UsartRetiming.cpp
+ * @brief     EOOS USART baud rate retiming on clock changes
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "pcb.UsartRetiming.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+namespace
+{
+
+/**
+ * @brief Addresses of USART registers.
+ */
+const uint32_t ADDRESS_USART[3] = { 0x40013800U, 0x40004400U, 0x40004800U };
+
+const uint32_t SR_TC( 0x00000040U );   ///< Transmission complete.
+const uint32_t CR1_TE( 0x00000008U );  ///< Transmitter enable.
+const uint32_t CR1_UE( 0x00002000U );  ///< USART enable.
+
+/**
+ * @brief Minimum value of BRR register, which is USARTDIV of one.
+ */
+const uint32_t BRR_MINIMUM( 16U );
+
+/**
+ * @brief Number of polls of the transmission complete flag.
+ */
+const int32_t COMPLETE_POLLS( 100000 );
+
+} // namespace
+
+UsartRetiming::UsartRetiming(Number const number)
+    : ClockListener()
+    , number_( number )
+    , reg_( *reinterpret_cast<Registers*>(ADDRESS_USART[number]) )
+    , baud_( 0U ) {
+}
+
+UsartRetiming::~UsartRetiming()
+{
+}
+
+bool_t UsartRetiming::suspend(ClockFrequencies const& current, ClockFrequencies const& next)
+{
+    bool_t res( false );
+    do
+    {
+        baud_ = 0U;
+        uint32_t const cr1( reg_.cr1 );
+        uint32_t const brr( reg_.brr );
+        if( ((cr1 & CR1_UE) == 0U) || (brr == 0U) )
+        {
+            res = true;
+            break;
+        }
+        if( (cr1 & CR1_TE) != 0U )
+        {
+            // Let the current frame be sent at the current baud rate
+            int32_t polls( COMPLETE_POLLS );
+            while( ((reg_.sr & SR_TC) == 0U) && (polls > 0) )
+            {
+                polls--;
+            }
+        }
+        uint32_t const baud( (getClock(current) + (brr >> 1)) / brr );
+        if( (baud == 0U) || (((getClock(next) + (baud >> 1)) / baud) < BRR_MINIMUM) )
+        {
+            break;
+        }
+        baud_ = baud;
+        res = true;
+    } while(false);
+    return res;
+}
+
+void UsartRetiming::resume(ClockFrequencies const& frequencies)
+{
+    if( baud_ != 0U )
+    {
+        reg_.brr = (getClock(frequencies) + (baud_ >> 1)) / baud_;
+    }
+}
+
+uint32_t UsartRetiming::getClock(ClockFrequencies const& frequencies) const
+{
+    return (number_ == NUMBER_USART1) ? frequencies.pclk2 : frequencies.pclk1;
+}
+
+} // namespace pcb
+} // namespace eoos
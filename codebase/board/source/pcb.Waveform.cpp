@@ -0,0 +1,354 @@
+/**
+ * @file      pcb.Waveform.cpp
+ * @brief     EOOS DMA driven GPIO waveform
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "pcb.Waveform.hpp"
+#include "pcb.ClockScaler.hpp"
+#include "pcb.Nvic.hpp"
+#include "pcb.Register.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+namespace
+{
+
+typedef Peripheral<0x40000000U> Tim2; ///< TIM2 timer.
+typedef Peripheral<0x40020000U> Dma1; ///< DMA1 controller.
+typedef Peripheral<0x40021000U> Rcc;  ///< Reset and clock control.
+
+typedef Register<Tim2, 0x00U> TimCr1;                       ///< Control register 1.
+typedef Register<Tim2, 0x0CU> TimDier;                      ///< DMA/interrupt enable register.
+typedef Register<Tim2, 0x10U> TimSr;                        ///< Status register.
+typedef Register<Tim2, 0x14U, REGISTER_ACCESS_WO> TimEgr;   ///< Event generation register.
+typedef Register<Tim2, 0x24U> TimCnt;                       ///< Counter.
+typedef Register<Tim2, 0x28U> TimPsc;                       ///< Prescaler.
+typedef Register<Tim2, 0x2CU> TimArr;                       ///< Auto-reload register.
+
+typedef RegisterField<TimCr1, 0U> TimCr1Cen;                ///< Counter enable.
+typedef RegisterField<TimDier, 8U> TimDierUde;              ///< Update DMA request enable.
+typedef RegisterField<TimEgr, 0U> TimEgrUg;                 ///< Update generation.
+
+typedef Register<Dma1, 0x00U, REGISTER_ACCESS_RO> DmaIsr;   ///< Interrupt status register.
+typedef Register<Dma1, 0x04U, REGISTER_ACCESS_WO> DmaIfcr;  ///< Interrupt flag clear register.
+typedef Register<Dma1, 0x1CU> DmaCcr;                       ///< Channel 2 configuration register.
+typedef Register<Dma1, 0x20U> DmaCndtr;                     ///< Channel 2 number of data register.
+typedef Register<Dma1, 0x24U> DmaCpar;                      ///< Channel 2 peripheral address register.
+typedef Register<Dma1, 0x28U> DmaCmar;                      ///< Channel 2 memory address register.
+
+typedef RegisterField<DmaIsr, 5U> DmaIsrTcif;               ///< Channel 2 transfer complete flag.
+typedef RegisterField<DmaIsr, 6U> DmaIsrHtif;               ///< Channel 2 half transfer flag.
+typedef RegisterField<DmaIsr, 7U> DmaIsrTeif;               ///< Channel 2 transfer error flag.
+typedef RegisterField<DmaIsr, 4U, 4U> DmaIsrChannel;        ///< Channel 2 flags.
+typedef RegisterField<DmaIfcr, 4U, 4U> DmaIfcrChannel;      ///< Channel 2 flags clear.
+
+typedef RegisterField<DmaCcr, 0U> DmaCcrEn;                 ///< Channel enable.
+typedef RegisterField<DmaCcr, 1U> DmaCcrTcie;               ///< Transfer complete interrupt enable.
+typedef RegisterField<DmaCcr, 2U> DmaCcrHtie;               ///< Half transfer interrupt enable.
+typedef RegisterField<DmaCcr, 3U> DmaCcrTeie;               ///< Transfer error interrupt enable.
+typedef RegisterField<DmaCcr, 4U> DmaCcrDir;                ///< Read from memory.
+typedef RegisterField<DmaCcr, 5U> DmaCcrCirc;               ///< Circular mode.
+typedef RegisterField<DmaCcr, 7U> DmaCcrMinc;               ///< Memory increment mode.
+typedef RegisterField<DmaCcr, 8U, 2U> DmaCcrPsize;          ///< Peripheral size.
+typedef RegisterField<DmaCcr, 10U, 2U> DmaCcrMsize;         ///< Memory size.
+typedef RegisterField<DmaCcr, 12U, 2U> DmaCcrPl;            ///< Channel priority level.
+
+const uint32_t DMA_SIZE_32( 2U );       ///< Size of 32 bits.
+const uint32_t DMA_PRIORITY_HIGH( 3U ); ///< Very high priority.
+
+typedef Register<Rcc, 0x14U> RccAhbenr;                     ///< AHB peripheral clock enable register.
+typedef Register<Rcc, 0x1CU> RccApb1enr;                    ///< APB1 peripheral clock enable register.
+
+typedef RegisterField<RccAhbenr, 0U> RccAhbenrDma1en;       ///< DMA1 clock enable.
+typedef RegisterField<RccApb1enr, 0U> RccApb1enrTim2en;     ///< TIM2 clock enable.
+
+} // namespace
+
+Waveform* Waveform::waveform_( NULLPTR );
+
+Waveform::Waveform(Config const& config)
+    : lib::NonCopyable<lib::NoAllocator>()
+    , ClockListener()
+    , port_( config.port )
+    , rate_( config.rate )
+    , clock_( 0U )
+    , prescaler_( 0U )
+    , reload_( 0U )
+    , notifier_( Notifier::TYPE_BINARY )
+    , words_( NULLPTR )
+    , length_( 0 )
+    , source_( NULLPTR )
+    , isActive_( false )
+    , underruns_( 0U ) {
+    bool_t const isConstructed( construct(config) );
+    setConstructed( isConstructed );
+}
+
+Waveform::~Waveform()
+{
+    if( waveform_ == this )
+    {
+        ClockScaler* const scaler( ClockScaler::get() );
+        if( scaler != NULLPTR )
+        {
+            static_cast<void>( scaler->removeListener(*this) );
+        }
+        stop();
+        static_cast<void>( Nvic::disable(Nvic::IRQ_DMA1_CHANNEL2) );
+        waveform_ = NULLPTR;
+    }
+}
+
+bool_t Waveform::suspend(ClockFrequencies const&, ClockFrequencies const& next)
+{
+    return rate_ <= static_cast<int32_t>(ClockScaler::getApb1TimerClock(next) / static_cast<uint32_t>(RATE_DIVIDER));
+}
+
+void Waveform::resume(ClockFrequencies const& frequencies)
+{
+    setTiming(ClockScaler::getApb1TimerClock(frequencies));
+    if( isActive_ )
+    {
+        // The prescaler is loaded on the next update event, so one word can be written at the old rate
+        TimPsc::write(prescaler_);
+        TimArr::write(reload_);
+    }
+}
+
+bool_t Waveform::write(uint32_t const* const words, int32_t const length)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        words_ = NULLPTR;
+        length_ = 0;
+        source_ = NULLPTR;
+        res = run(words, length, false);
+    }
+    return res;
+}
+
+bool_t Waveform::start(uint32_t* const words, int32_t const length, Source* const source)
+{
+    bool_t res( false );
+    if( isConstructed() && ((length & 1) == 0) )
+    {
+        words_ = words;
+        length_ = length;
+        source_ = source;
+        res = run(words, length, true);
+    }
+    return res;
+}
+
+void Waveform::stop()
+{
+    if( isConstructed() )
+    {
+        TimCr1::write(0U);
+        TimDier::write(0U);
+        DmaCcr::write(0U);
+        DmaIfcr::write( DmaIfcrChannel::set() );
+        isActive_ = false;
+    }
+}
+
+bool_t Waveform::wait(int32_t const timeout)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        while( isActive_ && notifier_.wait(timeout) ){}
+        res = !isActive_;
+    }
+    return res;
+}
+
+bool_t Waveform::isActive() const
+{
+    return isActive_;
+}
+
+int32_t Waveform::getRate() const
+{
+    int32_t res( 0 );
+    if( isConstructed() )
+    {
+        res = static_cast<int32_t>( clock_ / ((prescaler_ + 1U) * (reload_ + 1U)) );
+    }
+    return res;
+}
+
+uint32_t Waveform::getUnderruns() const
+{
+    return underruns_;
+}
+
+bool_t Waveform::construct(Config const& config)
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {
+            break;
+        }
+        if( (config.rate <= 0) || (config.rate > MAXIMUM_RATE) )
+        {
+            break;
+        }
+        if( ((config.mask & ~GpioPort::MASK_ALL) != 0U) || (config.mask == 0U) )
+        {
+            break;
+        }
+        if( waveform_ != NULLPTR )
+        {
+            break;
+        }
+        ClockFrequencies const frequencies( ClockScaler::getFrequencies() );
+        if( config.rate > static_cast<int32_t>(ClockScaler::getApb1TimerClock(frequencies) / static_cast<uint32_t>(RATE_DIVIDER)) )
+        {
+            break;
+        }
+        if( !notifier_.bind() )
+        {
+            break;
+        }
+        setTiming(ClockScaler::getApb1TimerClock(frequencies));
+        port_.configure(config.mask, GpioPort::MODE_OUTPUT_PUSH_PULL);
+        taskENTER_CRITICAL();
+        RccAhbenr::modify( RccAhbenrDma1en::set() );
+        RccApb1enr::modify( RccApb1enrTim2en::set() );
+        taskEXIT_CRITICAL();
+        waveform_ = this;
+        stop();
+        if( !Nvic::setHandler(Nvic::IRQ_DMA1_CHANNEL2, &Waveform::handleDma) )
+        {
+            waveform_ = NULLPTR;
+            break;
+        }
+        static_cast<void>( Nvic::setPriority(Nvic::IRQ_DMA1_CHANNEL2, configMAX_SYSCALL_INTERRUPT_PRIORITY) );
+        static_cast<void>( Nvic::clearPending(Nvic::IRQ_DMA1_CHANNEL2) );
+        static_cast<void>( Nvic::enable(Nvic::IRQ_DMA1_CHANNEL2) );
+        ClockScaler* const scaler( ClockScaler::get() );
+        if( (scaler != NULLPTR) && !scaler->addListener(*this) )
+        {
+            waveform_ = NULLPTR;
+            static_cast<void>( Nvic::disable(Nvic::IRQ_DMA1_CHANNEL2) );
+            break;
+        }
+        res = true;
+    } while(false);
+    return res;
+}
+
+bool_t Waveform::run(uint32_t const* const words, int32_t const length, bool_t const circular)
+{
+    bool_t res( false );
+    do
+    {
+        if( (words == NULLPTR) || (length <= 0) || (length > MAXIMUM_LENGTH) )
+        {
+            break;
+        }
+        stop();
+        // Drop a notification of the previous writing, which the wait has not taken
+        static_cast<void>( notifier_.clear() );
+        DmaCpar::write( reinterpret_cast<uint32_t>( &GpioPort::getRegisters(port_.getNumber()).bsrr ) );
+        DmaCmar::write( reinterpret_cast<uint32_t>( words ) );
+        DmaCndtr::write( static_cast<uint32_t>( length ) );
+        DmaCcr::Value ccr( DmaCcrDir::set() | DmaCcrMinc::set() | DmaCcrPsize::value(DMA_SIZE_32)
+                         | DmaCcrMsize::value(DMA_SIZE_32) | DmaCcrPl::value(DMA_PRIORITY_HIGH) | DmaCcrTeie::set() );
+        if( !circular )
+        {
+            ccr = ccr | DmaCcrTcie::set();
+        }
+        else if( source_ != NULLPTR )
+        {
+            ccr = ccr | DmaCcrCirc::set() | DmaCcrHtie::set() | DmaCcrTcie::set();
+        }
+        else
+        {
+            ccr = ccr | DmaCcrCirc::set();
+        }
+        isActive_ = true;
+        DmaCcr::write(ccr);
+        DmaCcr::write(ccr | DmaCcrEn::set());
+        // Load the prescaler by an update event before DMA requests are enabled,
+        // so that the event does not request writing the first word earlier
+        TimPsc::write(prescaler_);
+        TimArr::write(reload_);
+        TimCnt::write(0U);
+        TimEgr::write( TimEgrUg::set() );
+        TimSr::write(0U);
+        TimDier::write( TimDierUde::set() );
+        TimCr1::write( TimCr1Cen::set() );
+        res = true;
+    } while(false);
+    return res;
+}
+
+void Waveform::setTiming(uint32_t const clock)
+{
+    uint32_t const ticks( clock / static_cast<uint32_t>(rate_) );
+    clock_ = clock;
+    prescaler_ = (ticks - 1U) >> 16;
+    reload_ = ticks / (prescaler_ + 1U) - 1U;
+}
+
+void Waveform::handleDma()
+{
+    Waveform* const waveform( waveform_ );
+    uint32_t const isr( DmaIsr::read() );
+    DmaIfcr::write( isr & DmaIsrChannel::MASK );
+    do
+    {
+        if( waveform == NULLPTR )
+        {
+            break;
+        }
+        if( DmaIsrTeif::isSet(isr) )
+        {
+            waveform->stop();
+            static_cast<void>( waveform->notifier_.notifyFromInterrupt() );
+            break;
+        }
+        if( waveform->words_ == NULLPTR )
+        {
+            if( DmaIsrTcif::isSet(isr) )
+            {
+                // The last word is written, but the timer is stopped after it
+                // to keep the pins from unexpected switching by restart
+                waveform->stop();
+                static_cast<void>( waveform->notifier_.notifyFromInterrupt() );
+            }
+            break;
+        }
+        Source* const source( waveform->source_ );
+        if( source == NULLPTR )
+        {
+            break;
+        }
+        int32_t const half( waveform->length_ >> 1 );
+        if( DmaIsrHtif::isSet(isr) && DmaIsrTcif::isSet(isr) )
+        {
+            // Both halves have been written since the last interrupt
+            waveform->underruns_ = waveform->underruns_ + 1U;
+            break;
+        }
+        if( DmaIsrHtif::isSet(isr) )
+        {
+            source->fill(waveform->words_, half);
+        }
+        if( DmaIsrTcif::isSet(isr) )
+        {
+            source->fill(waveform->words_ + half, half);
+        }
+    } while(false);
+}
+
+} // namespace pcb
+} // namespace eoos
@@ -0,0 +1,25 @@
+/**
+ * @file      BenchmarkTest.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of microbenchmark.
+ */
+#ifndef TST_BENCHMARKTEST_HPP_
+#define TST_BENCHMARKTEST_HPP_
+ 
+#include "Types.hpp"
+
+namespace eoos
+{
+
+/**
+ * @brief Tests statistics of microbenchmark on a simulated counter, and benchmarks primitives of the board.
+ *
+ * The function returns on success and calls TestRunner::fail() on failure.
+ */
+void testBenchmark();
+
+} // namespace eoos
+
+#endif // TST_BENCHMARKTEST_HPP_
@@ -0,0 +1,25 @@
+/**
+ * @file      CanHealthTest.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of CAN controller health monitor.
+ */
+#ifndef TST_CANHEALTHTEST_HPP_
+#define TST_CANHEALTHTEST_HPP_
+ 
+#include "Types.hpp"
+
+namespace eoos
+{
+
+/**
+ * @brief Tests counters, events and bus-off recovery with back-off on a fault-injecting virtual controller.
+ *
+ * The function returns on success and calls TestRunner::fail() on failure.
+ */
+void testCanHealth();
+
+} // namespace eoos
+
+#endif // TST_CANHEALTHTEST_HPP_
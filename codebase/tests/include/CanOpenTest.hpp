@@ -0,0 +1,25 @@
+/**
+ * @file      CanOpenTest.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of CANopen process data objects.
+ */
+#ifndef TST_CANOPENTEST_HPP_
+#define TST_CANOPENTEST_HPP_
+ 
+#include "Types.hpp"
+
+namespace eoos
+{
+
+/**
+ * @brief Tests PDO mapping and SYNC handling on a simulated bus, and benchmarks SYNC-to-TPDO latency and PDO throughput.
+ *
+ * The function returns on success and calls TestRunner::fail() on failure.
+ */
+void testCanOpen();
+
+} // namespace eoos
+
+#endif // TST_CANOPENTEST_HPP_
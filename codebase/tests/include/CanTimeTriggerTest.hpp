@@ -0,0 +1,25 @@
+/**
+ * @file      CanTimeTriggerTest.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of CAN time-triggered communication.
+ */
+#ifndef TST_CANTIMETRIGGERTEST_HPP_
+#define TST_CANTIMETRIGGERTEST_HPP_
+ 
+#include "Types.hpp"
+
+namespace eoos
+{
+
+/**
+ * @brief Tests a schedule table and time stamps of frames in the loopback mode, and measures jitter of the cyclic frames.
+ *
+ * The function returns on success and calls TestRunner::fail() on failure.
+ */
+void testCanTimeTrigger();
+
+} // namespace eoos
+
+#endif // TST_CANTIMETRIGGERTEST_HPP_
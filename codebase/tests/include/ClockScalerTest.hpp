@@ -0,0 +1,26 @@
+/**
+ * @file      ClockScalerTest.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of clock frequency scaling.
+ */
+#ifndef TST_CLOCKSCALERTEST_HPP_
+#define TST_CLOCKSCALERTEST_HPP_
+ 
+#include "Types.hpp"
+
+namespace eoos
+{
+
+/**
+ * @brief Tests switches of clock profiles with CAN in loopback mode and USART output.
+ *
+ * The function returns on success and calls TestRunner::fail() on failure.
+ * USART output must be readable in all profiles.
+ */
+void testClockScaler();
+
+} // namespace eoos
+
+#endif // TST_CLOCKSCALERTEST_HPP_
@@ -0,0 +1,25 @@
+/**
+ * @file      ClockTest.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of monotonic high-resolution clock.
+ */
+#ifndef TST_CLOCKTEST_HPP_
+#define TST_CLOCKTEST_HPP_
+ 
+#include "Types.hpp"
+
+namespace eoos
+{
+
+/**
+ * @brief Tests monotonic high-resolution clock and drift of periodic sleeping.
+ *
+ * The function returns on success and calls TestRunner::fail() on failure.
+ */
+void testClock();
+
+} // namespace eoos
+
+#endif // TST_CLOCKTEST_HPP_
@@ -0,0 +1,25 @@
+/**
+ * @file      EdgeCaptureTest.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of GPIO edge capture.
+ */
+#ifndef TST_EDGECAPTURETEST_HPP_
+#define TST_EDGECAPTURETEST_HPP_
+ 
+#include "Types.hpp"
+
+namespace eoos
+{
+
+/**
+ * @brief Tests GPIO edge capture and benchmarks latency of the interrupt entry.
+ *
+ * The function returns on success and calls TestRunner::fail() on failure.
+ */
+void testEdgeCapture();
+
+} // namespace eoos
+
+#endif // TST_EDGECAPTURETEST_HPP_
@@ -0,0 +1,25 @@
+/**
+ * @file      EventGroupTest.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of event group.
+ */
+#ifndef TST_EVENTGROUPTEST_HPP_
+#define TST_EVENTGROUPTEST_HPP_
+ 
+#include "Types.hpp"
+
+namespace eoos
+{
+
+/**
+ * @brief Tests event group.
+ *
+ * The function returns on success and calls TestRunner::fail() on failure.
+ */
+void testEventGroup();
+
+} // namespace eoos
+
+#endif // TST_EVENTGROUPTEST_HPP_
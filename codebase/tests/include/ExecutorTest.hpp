@@ -0,0 +1,25 @@
+/**
+ * @file      ExecutorTest.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of executor.
+ */
+#ifndef TST_EXECUTORTEST_HPP_
+#define TST_EXECUTORTEST_HPP_
+ 
+#include "Types.hpp"
+
+namespace eoos
+{
+
+/**
+ * @brief Tests executor and benchmarks it against a thread per job.
+ *
+ * The function returns on success and calls TestRunner::fail() on failure.
+ */
+void testExecutor();
+
+} // namespace eoos
+
+#endif // TST_EXECUTORTEST_HPP_
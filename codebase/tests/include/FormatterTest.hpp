@@ -0,0 +1,25 @@
+/**
+ * @file      FormatterTest.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of buffered formatter.
+ */
+#ifndef TST_FORMATTERTEST_HPP_
+#define TST_FORMATTERTEST_HPP_
+ 
+#include "Types.hpp"
+
+namespace eoos
+{
+
+/**
+ * @brief Tests buffered formatter and benchmarks it against direct stream output.
+ *
+ * The function returns on success and calls TestRunner::fail() on failure.
+ */
+void testFormatter();
+
+} // namespace eoos
+
+#endif // TST_FORMATTERTEST_HPP_
@@ -0,0 +1,25 @@
+/**
+ * @file      GpioPortTest.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of port-wide GPIO access.
+ */
+#ifndef TST_GPIOPORTTEST_HPP_
+#define TST_GPIOPORTTEST_HPP_
+ 
+#include "Types.hpp"
+
+namespace eoos
+{
+
+/**
+ * @brief Tests port-wide GPIO access and benchmarks it against GPIO driver.
+ *
+ * The function returns on success and calls TestRunner::fail() on failure.
+ */
+void testGpioPort();
+
+} // namespace eoos
+
+#endif // TST_GPIOPORTTEST_HPP_
@@ -0,0 +1,28 @@
+/**
+ * @file      InterruptLatencyTest.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of interrupt latency and jitter under load.
+ */
+#ifndef TST_INTERRUPTLATENCYTEST_HPP_
+#define TST_INTERRUPTLATENCYTEST_HPP_
+ 
+#include "Types.hpp"
+
+namespace eoos
+{
+
+/**
+ * @brief Benchmarks latency and jitter of a hardware timer interrupt under background load.
+ *
+ * The suite is the acceptance gate of driver changes, and its results before and
+ * after a change are to be compared.
+ *
+ * The function returns on success and calls TestRunner::fail() on failure.
+ */
+void testInterruptLatency();
+
+} // namespace eoos
+
+#endif // TST_INTERRUPTLATENCYTEST_HPP_
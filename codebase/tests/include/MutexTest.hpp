@@ -16,8 +16,7 @@ namespace eoos
 /**
  * @brief Tests Mutex.
  *
- * This function won't return and will break all CPU registers and C/C++ ABI.
- * This test must be checked visually on the appropriate break points.
+ * The function returns on success and calls TestRunner::fail() on failure.
  */
 void testMutex();
 
@@ -0,0 +1,25 @@
+/**
+ * @file      PeriodicTaskTest.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of rate-monotonic periodic tasks.
+ */
+#ifndef TST_PERIODICTASKTEST_HPP_
+#define TST_PERIODICTASKTEST_HPP_
+ 
+#include "Types.hpp"
+
+namespace eoos
+{
+
+/**
+ * @brief Tests rate-monotonic periodic tasks and prints their response times.
+ *
+ * The function returns on success and calls TestRunner::fail() on failure.
+ */
+void testPeriodicTask();
+
+} // namespace eoos
+
+#endif // TST_PERIODICTASKTEST_HPP_
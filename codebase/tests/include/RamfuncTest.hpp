@@ -0,0 +1,25 @@
+/**
+ * @file      RamfuncTest.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of functions executed from SRAM.
+ */
+#ifndef TST_RAMFUNCTEST_HPP_
+#define TST_RAMFUNCTEST_HPP_
+ 
+#include "Types.hpp"
+
+namespace eoos
+{
+
+/**
+ * @brief Tests functions placed to SRAM and benchmarks them against FLASH.
+ *
+ * The function returns on success and calls TestRunner::fail() on failure.
+ */
+void testRamfunc();
+
+} // namespace eoos
+
+#endif // TST_RAMFUNCTEST_HPP_
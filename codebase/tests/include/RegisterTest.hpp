@@ -0,0 +1,25 @@
+/**
+ * @file      RegisterTest.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of typed register access.
+ */
+#ifndef TST_REGISTERTEST_HPP_
+#define TST_REGISTERTEST_HPP_
+ 
+#include "Types.hpp"
+
+namespace eoos
+{
+
+/**
+ * @brief Tests typed register access on a simulated register file and benchmarks it against bit-fields.
+ *
+ * The function returns on success and calls TestRunner::fail() on failure.
+ */
+void testRegister();
+
+} // namespace eoos
+
+#endif // TST_REGISTERTEST_HPP_
@@ -0,0 +1,25 @@
+/**
+ * @file      StacklessTaskTest.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of stackless tasks.
+ */
+#ifndef TST_STACKLESSTASKTEST_HPP_
+#define TST_STACKLESSTASKTEST_HPP_
+ 
+#include "Types.hpp"
+
+namespace eoos
+{
+
+/**
+ * @brief Tests stackless tasks and benchmarks them against threads.
+ *
+ * The function returns on success and calls TestRunner::fail() on failure.
+ */
+void testStacklessTask();
+
+} // namespace eoos
+
+#endif // TST_STACKLESSTASKTEST_HPP_
@@ -0,0 +1,25 @@
+/**
+ * @file      StaticInterruptTest.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of interrupts with handlers bound at compile time.
+ */
+#ifndef TST_STATICINTERRUPTTEST_HPP_
+#define TST_STATICINTERRUPTTEST_HPP_
+ 
+#include "Types.hpp"
+
+namespace eoos
+{
+
+/**
+ * @brief Tests interrupts with static and dynamic handlers and benchmarks their entry latency.
+ *
+ * The function returns on success and calls TestRunner::fail() on failure.
+ */
+void testStaticInterrupt();
+
+} // namespace eoos
+
+#endif // TST_STATICINTERRUPTTEST_HPP_
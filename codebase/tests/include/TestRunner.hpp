@@ -0,0 +1,243 @@
+/**
+ * @file      TestRunner.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Runner of test suites.
+ */
+#ifndef TST_TESTRUNNER_HPP_
+#define TST_TESTRUNNER_HPP_
+
+#include "lib.NonCopyable.hpp"
+#include "lib.NoAllocator.hpp"
+#include "pcb.Notifier.hpp"
+#include "TestSuite.hpp"
+
+namespace eoos
+{
+
+/**
+ * @class TestRunner
+ * @brief Runner of registered test suites with results in TAP version 13.
+ *
+ * Suites are selected by a command of space or comma separated words, which are
+ * names of suites, 'tests' for all regression tests, 'benchmarks' for all benchmarks,
+ * 'all' for both of them, and 'list' to print the registered suites. The command is
+ * taken from arguments of the program, or it is read from the debug USART, and 'all'
+ * is run if no command is entered in COMMAND_TIMEOUT.
+ *
+ * Each suite is run in its own thread, and its elapsed time in CPU cycles and its stack
+ * usage in bytes are reported. The thread is deleted when the suite returns, fails or
+ * its timeout expires. Objects of a failed or expired suite are not destroyed, and its
+ * threads, interrupt handlers and clock listeners keep referring to the stack, which is
+ * shared by the suites, therefore the run is bailed out then and no more suites are run.
+ *
+ * @note Object of the class must be alone in the system.
+ */
+class TestRunner : public lib::NonCopyable<lib::NoAllocator>
+{
+
+public:
+
+    /**
+     * @brief Maximum number of suites of one command.
+     */
+    static const int32_t MAXIMUM_SUITES = 32;
+
+    /**
+     * @brief Maximum length of a command in characters.
+     */
+    static const int32_t COMMAND_SIZE = 128;
+
+    /**
+     * @brief Timeout of the first command read from the debug USART in milliseconds.
+     */
+    static const int32_t COMMAND_TIMEOUT = 5000;
+
+    /**
+     * @brief Stack size of a suite thread in bytes.
+     *
+     * The size is of the largest suite with a margin, which is checked by the stack usage
+     * reported for each suite, as the suites keep large buffers in static memory.
+     */
+    static const int32_t STACK_SIZE = 4096;
+
+    /**
+     * @brief Constructor.
+     *
+     * The runner is bound to the thread of the constructor call.
+     */
+    TestRunner();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~TestRunner();
+
+    /**
+     * @brief Executes commands.
+     *
+     * If arguments are given, the function executes them as one command and returns.
+     * Otherwise, the function executes commands read from the debug USART and returns
+     * only if the run of a command is bailed out.
+     *
+     * @param argc The number of arguments passed to the program.
+     * @param argv An array of c-string of arguments where the last one - argc + 1 is null.
+     * @return Number of failed suites, or -1 if the command is wrong.
+     */
+    int32_t execute(int32_t argc, char_t* argv[]);
+
+    /**
+     * @brief Fails the running suite.
+     *
+     * The function is called by a suite or a thread of it on failure and won't return.
+     * The calling thread is stopped, and the suite thread is deleted by the runner.
+     * If the function is called by an interrupt handler or no suite is run by the runner,
+     * the function stops the CPU, as the interrupt cannot be left.
+     */
+    static void fail();
+
+private:
+
+    /**
+     * @enum Result
+     * @brief Results of a suite.
+     */
+    enum Result
+    {
+        RESULT_RUNNING = 0, ///< Suite is running.
+        RESULT_PASSED  = 1, ///< Suite returned.
+        RESULT_FAILED  = 2, ///< Suite failed.
+        RESULT_TIMEOUT = 3  ///< Timeout of the suite expired.
+    };
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return true if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Selects suites by a word of a command.
+     *
+     * @param word Word of the command.
+     * @return true if the word is valid.
+     */
+    bool_t select(char_t const* word);
+
+    /**
+     * @brief Selects suites by a command read from the debug USART.
+     *
+     * @param command Command, which is split into words in place.
+     * @return true if the command is valid.
+     */
+    bool_t parse(char_t* command);
+
+    /**
+     * @brief Selects suites of a type.
+     *
+     * @param type Type of suites.
+     * @return true if the suites are selected.
+     */
+    bool_t select(TestSuite::Type type);
+
+    /**
+     * @brief Selects a suite.
+     *
+     * @param suite Suite.
+     * @return true if the suite is selected.
+     */
+    bool_t select(TestSuite const& suite);
+
+    /**
+     * @brief Runs the selected suites.
+     *
+     * @return Number of failed suites.
+     */
+    int32_t run();
+
+    /**
+     * @brief Runs a suite.
+     *
+     * @param suite  Suite.
+     * @param cycles Elapsed time of the suite in CPU cycles.
+     * @param stack  Stack usage of the suite in bytes.
+     * @return Result of the suite.
+     */
+    Result run(TestSuite const& suite, uint64_t* cycles, int32_t* stack);
+
+    /**
+     * @brief Completes the running suite and stops the calling thread.
+     *
+     * @param result Result of the suite.
+     */
+    void complete(Result result);
+
+    /**
+     * @brief Prints the registered suites.
+     */
+    static void printList();
+
+    /**
+     * @brief Runs the suite in its thread.
+     *
+     * @param argument The runner.
+     */
+    static void handleTask(void* argument);
+
+    /**
+     * @brief Object of the class, as it must be alone.
+     */
+    static TestRunner* runner_;
+
+    /**
+     * @brief Stack of a suite thread.
+     */
+    static StackType_t stack_[STACK_SIZE / sizeof(StackType_t)];
+
+    /**
+     * @brief Control block of a suite thread.
+     */
+    static StaticTask_t control_;
+
+    /**
+     * @brief Selected suites.
+     */
+    TestSuite const* suites_[MAXIMUM_SUITES];
+
+    /**
+     * @brief Number of the selected suites.
+     */
+    int32_t number_;
+
+    /**
+     * @brief Running suite.
+     */
+    TestSuite const* volatile suite_;
+
+    /**
+     * @brief Result of the running suite.
+     */
+    Result volatile result_;
+
+    /**
+     * @brief Thread of the running suite.
+     */
+    TaskHandle_t task_;
+
+    /**
+     * @brief Notifier of the runner about completion of the suite and about received characters.
+     */
+    pcb::Notifier notifier_;
+
+    /**
+     * @brief A suite has failed or expired, so no more suites can be run.
+     */
+    bool_t isBailedOut_;
+
+};
+
+} // namespace eoos
+
+#endif // TST_TESTRUNNER_HPP_
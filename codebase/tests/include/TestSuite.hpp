@@ -0,0 +1,170 @@
+/**
+ * @file      TestSuite.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Registry of test suites.
+ */
+#ifndef TST_TESTSUITE_HPP_
+#define TST_TESTSUITE_HPP_
+
+#include "Types.hpp"
+
+namespace eoos
+{
+
+/**
+ * @class TestSuite
+ * @brief Test suite which registers itself on its construction.
+ *
+ * A suite source defines a static object of the class, so that the suite is
+ * known to the test runner without being called from the program. Suites are
+ * kept in a list sorted by their names and a suite is never unregistered.
+ *
+ * A suite function returns on success and calls TestRunner::fail() on failure.
+ */
+class TestSuite
+{
+
+public:
+
+    /**
+     * @enum Type
+     * @brief Types of suites.
+     */
+    enum Type
+    {
+        TYPE_TEST      = 0, ///< Regression test, which may print benchmarks of the tested functionality.
+        TYPE_BENCHMARK = 1, ///< Benchmark, which measures the board rather than checks functionality.
+        TYPE_MANUAL    = 2  ///< Suite which won't return or must be checked visually, so it is run only if it is selected by its name.
+    };
+
+    /**
+     * @brief Function of a suite.
+     */
+    typedef void (*Function)();
+
+    /**
+     * @brief Infinite timeout of a suite.
+     */
+    static const int32_t TIMEOUT_INFINITE = -1;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param name     Name of the suite, which must be unique.
+     * @param function Function of the suite.
+     * @param type     Type of the suite.
+     * @param timeout  Timeout of the suite in milliseconds, or TIMEOUT_INFINITE.
+     */
+    TestSuite(char_t const* name, Function function, Type type, int32_t timeout);
+
+    /**
+     * @brief Returns name of the suite.
+     *
+     * @return The name.
+     */
+    char_t const* getName() const;
+
+    /**
+     * @brief Returns function of the suite.
+     *
+     * @return The function.
+     */
+    Function getFunction() const;
+
+    /**
+     * @brief Returns type of the suite.
+     *
+     * @return The type.
+     */
+    Type getType() const;
+
+    /**
+     * @brief Returns timeout of the suite.
+     *
+     * @return Timeout in milliseconds, or TIMEOUT_INFINITE.
+     */
+    int32_t getTimeout() const;
+
+    /**
+     * @brief Returns the next suite of the list.
+     *
+     * @return The suite, or NULLPTR if this suite is the last one.
+     */
+    TestSuite const* getNext() const;
+
+    /**
+     * @brief Returns the first suite of the list.
+     *
+     * @return The suite, or NULLPTR if no suite is registered.
+     */
+    static TestSuite const* getFirst();
+
+    /**
+     * @brief Finds a suite by its name.
+     *
+     * @param name Name of the suite.
+     * @return The suite, or NULLPTR if it is not registered.
+     */
+    static TestSuite const* find(char_t const* name);
+
+    /**
+     * @brief Compares two strings.
+     *
+     * @param str1 String.
+     * @param str2 String.
+     * @return Difference of the first different characters, or zero if the strings are equal.
+     */
+    static int32_t compare(char_t const* str1, char_t const* str2);
+
+private:
+
+    /**
+     * @brief Copy constructor.
+     */
+    TestSuite(TestSuite const&);
+
+    /**
+     * @brief Copy assignment operator.
+     */
+    TestSuite& operator=(TestSuite const&);
+
+    /**
+     * @brief First suite of the list.
+     *
+     * The pointer is zero-initialized before any static constructor call,
+     * so suites of any translation unit are registered in any order.
+     */
+    static TestSuite* suites_;
+
+    /**
+     * @brief Name of the suite.
+     */
+    char_t const* name_;
+
+    /**
+     * @brief Function of the suite.
+     */
+    Function function_;
+
+    /**
+     * @brief Type of the suite.
+     */
+    Type type_;
+
+    /**
+     * @brief Timeout of the suite.
+     */
+    int32_t timeout_;
+
+    /**
+     * @brief Next suite of the list.
+     */
+    TestSuite* next_;
+
+};
+
+} // namespace eoos
+
+#endif // TST_TESTSUITE_HPP_
@@ -0,0 +1,25 @@
+/**
+ * @file      TimerTest.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of software timers.
+ */
+#ifndef TST_TIMERTEST_HPP_
+#define TST_TIMERTEST_HPP_
+ 
+#include "Types.hpp"
+
+namespace eoos
+{
+
+/**
+ * @brief Tests software timers and benchmarks them against a thread per period.
+ *
+ * The function returns on success and calls TestRunner::fail() on failure.
+ */
+void testTimer();
+
+} // namespace eoos
+
+#endif // TST_TIMERTEST_HPP_
@@ -0,0 +1,25 @@
+/**
+ * @file      WaveformTest.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of DMA driven GPIO waveform.
+ */
+#ifndef TST_WAVEFORMTEST_HPP_
+#define TST_WAVEFORMTEST_HPP_
+ 
+#include "Types.hpp"
+
+namespace eoos
+{
+
+/**
+ * @brief Tests DMA driven GPIO waveform and measures its timing.
+ *
+ * The function returns on success and calls TestRunner::fail() on failure.
+ */
+void testWaveform();
+
+} // namespace eoos
+
+#endif // TST_WAVEFORMTEST_HPP_
@@ -0,0 +1,25 @@
+/**
+ * @file      ZeroLatencyTest.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of zero-latency interrupts and BASEPRI critical sections.
+ */
+#ifndef TST_ZEROLATENCYTEST_HPP_
+#define TST_ZEROLATENCYTEST_HPP_
+ 
+#include "Types.hpp"
+
+namespace eoos
+{
+
+/**
+ * @brief Tests worst-case latency of interrupts in global and BASEPRI critical sections.
+ *
+ * The function returns on success and calls TestRunner::fail() on failure.
+ */
+void testZeroLatency();
+
+} // namespace eoos
+
+#endif // TST_ZEROLATENCYTEST_HPP_
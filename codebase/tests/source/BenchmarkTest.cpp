@@ -0,0 +1,219 @@
+/**
+ * @file      BenchmarkTest.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of microbenchmark.
+ */
+#include "BenchmarkTest.hpp"
+#include "TestRunner.hpp"
+#include "lib.Stream.hpp"
+#include "pcb.Benchmark.hpp"
+#include "pcb.Clock.hpp"
+#include "pcb.CriticalSection.hpp"
+
+namespace eoos
+{
+namespace
+{
+
+/**
+ * @brief Samples of a benchmark, which are not on the stack of the suite thread.
+ */
+uint32_t samples_[pcb::Benchmark::MAXIMUM_SAMPLES];
+
+/**
+ * @brief Simulated counter.
+ */
+uint32_t time_( 0U );
+
+uint32_t getTime()
+{
+    return time_;
+}
+
+/**
+ * @class SimulatedTask
+ * @brief Task which advances the simulated counter by the next duration.
+ */
+class SimulatedTask : public pcb::Benchmark::Task
+{
+
+public:
+
+    SimulatedTask()
+        : pcb::Benchmark::Task()
+        , runs_( 0 ) {
+    }
+
+    virtual void run()
+    {
+        // Durations from 1 to 100 ticks, and a long one on each hundredth run
+        runs_++;
+        time_ += ((runs_ % 100) == 0) ? 1000U : static_cast<uint32_t>(runs_ % 100);
+    }
+
+    int32_t getRuns() const
+    {
+        return runs_;
+    }
+
+private:
+
+    int32_t runs_;
+
+};
+
+/**
+ * @class ClockTask
+ * @brief Task which reads the monotonic clock.
+ */
+class ClockTask : public pcb::Benchmark::Task
+{
+
+public:
+
+    virtual void run()
+    {
+        static_cast<void>( pcb::Clock::getCycles() );
+    }
+
+};
+
+/**
+ * @class CriticalSectionTask
+ * @brief Task which enters and exits a critical section.
+ */
+class CriticalSectionTask : public pcb::Benchmark::Task
+{
+
+public:
+
+    virtual void run()
+    {
+        pcb::CriticalSection const section;
+    }
+
+};
+
+void testBenchmarkStatistics()
+{
+    pcb::Benchmark::Config config = {
+        .name = "simulated",
+        .mode = pcb::Benchmark::MODE_ITERATIONS,
+        .warmup = 0,
+        .iterations = 200,
+        .time = 0U,
+        .counter = &getTime,
+        .samples = samples_
+    };
+    {
+        pcb::Benchmark benchmark(config);
+        SimulatedTask task;
+        if( !benchmark.run(task) )
+        {   // Failure
+            TestRunner::fail();
+        }
+        // Samples are 1 to 99 twice, and 1000 twice
+        pcb::Benchmark::Result const& result( benchmark.getResult() );
+        if( (result.samples != 200) || (result.min != 1U) || (result.median != 51U) || (result.max != 1000U) )
+        {   // Failure
+            TestRunner::fail();
+        }
+        if( (result.p99 != 99U) || (result.mean != 59U) )
+        {   // Failure
+            TestRunner::fail();
+        }
+        if( (result.stddev < 98U) || (result.stddev > 100U) )
+        {   // Failure
+            TestRunner::fail();
+        }
+    }
+    // Warmup runs are not measured
+    config.warmup = 10;
+    config.iterations = 10;
+    {
+        pcb::Benchmark warm(config);
+        SimulatedTask warmTask;
+        static_cast<void>( warm.run(warmTask) );
+        if( (warmTask.getRuns() != 20) || (warm.getResult().min != 11U) )
+        {   // Failure
+            TestRunner::fail();
+        }
+    }
+    // Measuring is stopped by time
+    config.mode = pcb::Benchmark::MODE_TIME;
+    config.warmup = 0;
+    config.iterations = pcb::Benchmark::MAXIMUM_SAMPLES;
+    config.time = 100U;
+    {
+        pcb::Benchmark timed(config);
+        SimulatedTask timedTask;
+        static_cast<void>( timed.run(timedTask) );
+        if( timed.getResult().samples != 14 )
+        {   // Failure
+            TestRunner::fail();
+        }
+    }
+    config.iterations = pcb::Benchmark::MAXIMUM_SAMPLES + 1;
+    {
+        pcb::Benchmark wrong(config);
+        if( wrong.isConstructed() )
+        {   // Failure
+            TestRunner::fail();
+        }
+    }
+}
+
+void testBenchmarkBoard()
+{
+    pcb::Benchmark::Config config = {
+        .name = "clock",
+        .mode = pcb::Benchmark::MODE_ITERATIONS,
+        .warmup = 16,
+        .iterations = pcb::Benchmark::MAXIMUM_SAMPLES,
+        .time = 0U,
+        .counter = NULLPTR,
+        .samples = samples_
+    };
+    {
+        pcb::Benchmark benchmark(config);
+        ClockTask task;
+        if( !benchmark.run(task) )
+        {   // Failure
+            TestRunner::fail();
+        }
+        benchmark.print( lib::Stream::cout() );
+    }
+    config.name = "critical-section";
+    {
+        pcb::Benchmark benchmark(config);
+        CriticalSectionTask task;
+        if( !benchmark.run(task) )
+        {   // Failure
+            TestRunner::fail();
+        }
+        benchmark.print( lib::Stream::cout() );
+    }
+}
+
+} // namespace
+
+void testBenchmark()
+{
+    testBenchmarkStatistics();
+    testBenchmarkBoard();
+    // Success
+}
+
+namespace
+{
+
+/**
+ * @brief Registration of the suite.
+ */
+TestSuite const suite_("benchmark", testBenchmark, TestSuite::TYPE_TEST, 10000);
+
+} // namespace
+
+} // namespace eoos
@@ -0,0 +1,358 @@
+/**
+ * @file      CanHealthTest.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of CAN controller health monitor.
+ */
+#include "CanHealthTest.hpp"
+#include "TestRunner.hpp"
+#include "lib.Stream.hpp"
+#include "pcb.AbstractCanHealth.hpp"
+#include "pcb.EventGroup.hpp"
+
+namespace eoos
+{
+namespace
+{
+
+/**
+ * @brief Frames requested in a millisecond.
+ */
+const int32_t FRAMES_PER_TICK(4);
+
+/**
+ * @brief Time of 128 occurrences of 11 recessive bits at 250 Kbit/s in milliseconds.
+ */
+const int32_t RECOVERY_TIME(6);
+
+/**
+ * @brief Maximum number of restarts recorded.
+ */
+const int32_t MAXIMUM_RESTARTS(16);
+
+/**
+ * @brief All events of the monitor.
+ */
+const uint32_t EVENTS_ALL( pcb::AbstractCanHealth::EVENT_ERROR_ACTIVE | pcb::AbstractCanHealth::EVENT_ERROR_WARNING
+                         | pcb::AbstractCanHealth::EVENT_ERROR_PASSIVE | pcb::AbstractCanHealth::EVENT_BUS_OFF
+                         | pcb::AbstractCanHealth::EVENT_RECOVERED | pcb::AbstractCanHealth::EVENT_OVERRUN );
+
+/**
+ * @class VirtualCan
+ * @brief Virtual CAN controller with fault confinement and injected errors.
+ */
+class VirtualCan : public pcb::AbstractCanHealth
+{
+
+public:
+
+    VirtualCan(Policy const& policy, pcb::EventGroup* const events)
+        : pcb::AbstractCanHealth(policy, events)
+        , tec_( 0U )
+        , isBusOff_( false )
+        , recovery_( 0 )
+        , errorRate_( 0U )
+        , seed_( 1U )
+        , errors_( 0U )
+        , lost_( 0U )
+        , overruns_( 0U )
+        , time_( 0 )
+        , busOffTime_( 0 )
+        , isRestarted_( false )
+        , restarts_( 0 )
+        , delays_() {
+    }
+
+    virtual ~VirtualCan()
+    {
+    }
+
+    bool_t transmit()
+    {
+        bool_t res( false );
+        do
+        {
+            if( isBusOff_ )
+            {
+                break;
+            }
+            uint32_t const value( random() % 1000U );
+            if( value < errorRate_ )
+            {
+                errors_++;
+                tec_ += 8U;
+                if( tec_ > 255U )
+                {
+                    isBusOff_ = true;
+                    busOffTime_ = time_;
+                    isRestarted_ = false;
+                }
+                break;
+            }
+            if( value >= 980U )
+            {
+                // Arbitration is lost to a higher priority frame, and the frame is sent later
+                lost_++;
+                break;
+            }
+            tec_ = (tec_ > 0U) ? (tec_ - 1U) : 0U;
+            res = true;
+        } while(false);
+        return res;
+    }
+
+    void tick()
+    {
+        time_++;
+        if( recovery_ > 0 )
+        {
+            recovery_--;
+            if( recovery_ == 0 )
+            {
+                isBusOff_ = false;
+                tec_ = 0U;
+            }
+        }
+    }
+
+    void setErrorRate(uint32_t const perMille)
+    {
+        errorRate_ = perMille;
+    }
+
+    void injectOverrun()
+    {
+        overruns_++;
+    }
+
+    int32_t getRestarts() const
+    {
+        return restarts_;
+    }
+
+    int32_t getDelay(int32_t const index) const
+    {
+        return delays_[index];
+    }
+
+    void clearRestarts()
+    {
+        restarts_ = 0;
+    }
+
+protected:
+
+    virtual void sample(Sample* const sample)
+    {
+        sample->tec = (tec_ > 255U) ? 255U : tec_;
+        sample->rec = 0U;
+        sample->isWarning = tec_ >= 96U;
+        sample->isPassive = tec_ >= 128U;
+        sample->isBusOff = isBusOff_;
+        sample->errors = errors_;
+        sample->lostArbitrations = lost_;
+        sample->overruns = overruns_;
+        errors_ = 0U;
+        lost_ = 0U;
+        overruns_ = 0U;
+    }
+
+    virtual void restart()
+    {
+        if( isBusOff_ )
+        {
+            if( !isRestarted_ && (restarts_ < MAXIMUM_RESTARTS) )
+            {
+                delays_[restarts_] = time_ - busOffTime_;
+                restarts_++;
+            }
+            isRestarted_ = true;
+            recovery_ = RECOVERY_TIME;
+        }
+    }
+
+private:
+
+    uint32_t random()
+    {
+        seed_ = seed_ * 1103515245U + 12345U;
+        return seed_ >> 16;
+    }
+
+    uint32_t tec_;
+    bool_t isBusOff_;
+    int32_t recovery_;
+    uint32_t errorRate_;
+    uint32_t seed_;
+    uint32_t errors_;
+    uint32_t lost_;
+    uint32_t overruns_;
+    int32_t time_;
+    int32_t busOffTime_;
+    bool_t isRestarted_;
+    int32_t restarts_;
+    int32_t delays_[MAXIMUM_RESTARTS];
+
+};
+
+int32_t run(VirtualCan& can, int32_t const ticks)
+{
+    int32_t delivered( 0 );
+    for(int32_t i(0); i<ticks; i++)
+    {
+        can.tick();
+        for(int32_t j(0); j<FRAMES_PER_TICK; j++)
+        {
+            if( can.transmit() )
+            {
+                delivered++;
+            }
+        }
+        can.handle();
+    }
+    return delivered;
+}
+
+pcb::AbstractCanHealth::Policy const policy_ = {
+    .recovery = pcb::AbstractCanHealth::RECOVERY_AUTOMATIC,
+    .period = 1,
+    .initialDelay = 10,
+    .maximumDelay = 80,
+    .stableTime = 100
+};
+
+void testCanHealthPolicy()
+{
+    pcb::AbstractCanHealth::Policy policy( policy_ );
+    policy.initialDelay = 0;
+    VirtualCan can(policy, NULLPTR);
+    if( can.isConstructed() )
+    {   // Failure
+        TestRunner::fail();
+    }
+    policy.initialDelay = 100;
+    VirtualCan longer(policy, NULLPTR);
+    if( longer.isConstructed() )
+    {   // Failure
+        TestRunner::fail();
+    }
+}
+
+void testCanHealthBackOff()
+{
+    pcb::EventGroup events;
+    VirtualCan can(policy_, &events);
+    if( !can.isConstructed() || !events.isConstructed() )
+    {   // Failure
+        TestRunner::fail();
+    }
+    // Broken bus, on which each recovery is followed by bus-off
+    can.setErrorRate(1000U);
+    run(can, 500);
+    int32_t const expected[] = { 10, 20, 40, 80, 80 };
+    if( can.getRestarts() < 5 )
+    {   // Failure
+        TestRunner::fail();
+    }
+    for(int32_t i(0); i<5; i++)
+    {
+        if( can.getDelay(i) != expected[i] )
+        {   // Failure
+            TestRunner::fail();
+        }
+    }
+    pcb::AbstractCanHealth::Status status = { pcb::AbstractCanHealth::STATE_ERROR_ACTIVE };
+    if( !can.getStatus(&status) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( (status.busOffs < 5U) || (status.errors == 0U) || (status.delay != 80) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    uint32_t const offs( (status.state == pcb::AbstractCanHealth::STATE_BUS_OFF) ? 1U : 0U );
+    if( status.recoveries + offs != status.busOffs )
+    {   // Failure
+        TestRunner::fail();
+    }
+    uint32_t const expectedEvents( pcb::AbstractCanHealth::EVENT_ERROR_WARNING | pcb::AbstractCanHealth::EVENT_ERROR_PASSIVE
+                                 | pcb::AbstractCanHealth::EVENT_BUS_OFF | pcb::AbstractCanHealth::EVENT_RECOVERED );
+    if( (events.waitAny(EVENTS_ALL, 0) & expectedEvents) != expectedEvents )
+    {   // Failure
+        TestRunner::fail();
+    }
+    // Clean bus, on which the delay is reset after the stable time
+    can.setErrorRate(0U);
+    run(can, 300);
+    can.getStatus(&status);
+    if( (status.state != pcb::AbstractCanHealth::STATE_ERROR_ACTIVE) || (status.delay != 10) || (status.tec != 0U) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    can.clearRestarts();
+    can.setErrorRate(1000U);
+    run(can, 100);
+    if( (can.getRestarts() < 2) || (can.getDelay(0) != 10) || (can.getDelay(1) != 20) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    // Overrun
+    static_cast<void>( events.clearBits(EVENTS_ALL) );
+    can.injectOverrun();
+    can.update();
+    can.getStatus(&status);
+    if( (status.overruns != 1U) || (events.waitAny(pcb::AbstractCanHealth::EVENT_OVERRUN, 0) == 0U) )
+    {   // Failure
+        TestRunner::fail();
+    }
+}
+
+void testCanHealthThroughput()
+{
+    VirtualCan automatic(policy_, NULLPTR);
+    pcb::AbstractCanHealth::Policy policy( policy_ );
+    policy.recovery = pcb::AbstractCanHealth::RECOVERY_MANUAL;
+    VirtualCan manual(policy, NULLPTR);
+    int32_t const ticks( 5000 );
+    // Noisy bus, on which the error counter slowly rises to bus-off
+    automatic.setErrorRate(120U);
+    manual.setErrorRate(120U);
+    int32_t const delivered( run(automatic, ticks) );
+    int32_t const stalled( run(manual, ticks) );
+    pcb::AbstractCanHealth::Status status = { pcb::AbstractCanHealth::STATE_ERROR_ACTIVE };
+    manual.getStatus(&status);
+    if( (status.busOffs != 0U) && (delivered <= stalled) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( manual.recover() != (status.state == pcb::AbstractCanHealth::STATE_BUS_OFF) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    automatic.getStatus(&status);
+    lib::Stream::cout() << "CAN HEALTH: Delivered " << delivered << " of " << ticks * FRAMES_PER_TICK << " frames with recovery and " << stalled << " without it\r\n";
+    lib::Stream::cout() << "CAN HEALTH: Bus-off " << static_cast<int32_t>(status.busOffs) << " times, lost arbitration " << static_cast<int32_t>(status.lostArbitrations) << " times\r\n";
+}
+
+} // namespace
+
+void testCanHealth()
+{
+    testCanHealthPolicy();
+    testCanHealthBackOff();
+    testCanHealthThroughput();
+    // Success
+}
+
+namespace
+{
+
+/**
+ * @brief Registration of the suite.
+ */
+TestSuite const suite_("can-health", testCanHealth, TestSuite::TYPE_TEST, 30000);
+
+} // namespace
+
+} // namespace eoos
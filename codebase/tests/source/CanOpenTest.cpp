@@ -0,0 +1,292 @@
+/**
+ * @file      CanOpenTest.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of CANopen process data objects.
+ */
+#include "CanOpenTest.hpp"
+#include "TestRunner.hpp"
+#include "lib.Stream.hpp"
+#include "pcb.CanOpenNode.hpp"
+#include "pcb.CanOpenObject.hpp"
+#include "pcb.CycleCounter.hpp"
+
+namespace eoos
+{
+namespace
+{
+
+/**
+ * @brief Number of SYNCs of a benchmark.
+ */
+const int32_t NUMBER_OF_SYNCS(10000);
+
+typedef pcb::CanOpenObject<0x6041U, 0x00U, uint16_t, 0U> StatusWord;     ///< TPDO1 status word.
+typedef pcb::CanOpenObject<0x6064U, 0x00U, int32_t, 2U> ActualPosition;  ///< TPDO1 position actual value.
+typedef pcb::CanOpenObject<0x606CU, 0x00U, int16_t, 6U> ActualVelocity;  ///< TPDO1 velocity actual value.
+typedef pcb::CanOpenObject<0x2000U, 0x01U, uint8_t, 0U> Temperature;     ///< TPDO2 temperature.
+typedef pcb::CanOpenObject<0x6040U, 0x00U, uint16_t, 0U> ControlWord;    ///< RPDO1 control word.
+typedef pcb::CanOpenObject<0x607AU, 0x00U, int32_t, 2U> TargetPosition;  ///< RPDO1 target position.
+
+typedef pcb::CanOpenMapping<StatusWord, ActualPosition, ActualVelocity> Tpdo1Mapping; ///< TPDO1 mapping.
+typedef pcb::CanOpenMapping<Temperature> Tpdo2Mapping;                                ///< TPDO2 mapping.
+typedef pcb::CanOpenMapping<ControlWord, TargetPosition> Rpdo1Mapping;                ///< RPDO1 mapping.
+
+/**
+ * @class Bus
+ * @brief Simulated bus which records the last frame sent.
+ */
+class Bus : public pcb::CanOpenBus
+{
+
+public:
+
+    Bus()
+        : pcb::CanOpenBus()
+        , message_()
+        , time_( 0U )
+        , count_( 0 )
+        , isFull_( false ) {
+    }
+
+    virtual ~Bus()
+    {
+    }
+
+    virtual bool_t transmit(drv::Can::Message const& message)
+    {
+        bool_t res( false );
+        if( !isFull_ )
+        {
+            time_ = pcb::CycleCounter::get();
+            message_ = message;
+            count_++;
+            res = true;
+        }
+        return res;
+    }
+
+    drv::Can::Message const& getMessage() const
+    {
+        return message_;
+    }
+
+    uint32_t getTime() const
+    {
+        return time_;
+    }
+
+    int32_t getCount() const
+    {
+        return count_;
+    }
+
+    void setFull(bool_t const isFull)
+    {
+        isFull_ = isFull;
+    }
+
+private:
+
+    drv::Can::Message message_;
+    uint32_t time_;
+    int32_t count_;
+    bool_t isFull_;
+
+};
+
+drv::Can::Message createMessage(uint32_t const cobId, int32_t const dlc, uint64_t const data)
+{
+    drv::Can::Message message = {
+        .id  = {
+            .exid = 0,
+            .stid = cobId
+        },
+        .rtr = false,
+        .ide = false,
+        .dlc = dlc,
+        .data = {
+            .v64 = {
+                data
+            }
+        }
+    };
+    return message;
+}
+
+void testCanOpenMapping()
+{
+    if( (Tpdo1Mapping::DLC != 8) || (Tpdo1Mapping::NUMBER != 3) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( (Tpdo2Mapping::DLC != 1) || (Rpdo1Mapping::DLC != 6) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( ActualPosition::getMapping() != 0x60640020U )
+    {   // Failure
+        TestRunner::fail();
+    }
+    pcb::CanOpenPdo pdo(0x181U, Tpdo1Mapping::DLC);
+    if( !pdo.isConstructed() )
+    {   // Failure
+        TestRunner::fail();
+    }
+    StatusWord::write(pdo, 0x1237U);
+    ActualPosition::write(pdo, -2);
+    ActualVelocity::write(pdo, 0x4321);
+    // Little-endian layout of CANopen in the frame data
+    if( pdo.getMessage().data.v64[0] != 0x4321FFFFFFFE1237U )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( (StatusWord::read(pdo) != 0x1237U) || (ActualPosition::read(pdo) != -2) || (ActualVelocity::read(pdo) != 0x4321) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    pcb::CanOpenPdo wrong(0x182U, 9);
+    if( wrong.isConstructed() )
+    {   // Failure
+        TestRunner::fail();
+    }
+}
+
+void testCanOpenSync()
+{
+    Bus bus;
+    pcb::CanOpenNode node(bus);
+    pcb::CanOpenPdo tpdo1(0x181U, Tpdo1Mapping::DLC);
+    pcb::CanOpenPdo tpdo2(0x281U, Tpdo2Mapping::DLC);
+    pcb::CanOpenPdo rpdo1(0x201U, Rpdo1Mapping::DLC);
+    if( !node.addTpdo(tpdo1, 1U) || !node.addTpdo(tpdo2, 2U) || !node.addRpdo(rpdo1) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( node.addTpdo(tpdo1, 0U) || node.addTpdo(tpdo1, 241U) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    Temperature::write(tpdo2, 85U);
+    drv::Can::Message const sync( createMessage(pcb::CanOpenNode::COB_ID_SYNC, 0, 0U) );
+    // First SYNC sends TPDO1 only
+    if( !node.handleMessage(sync) || (bus.getCount() != 1) || (bus.getMessage().id.stid != 0x181U) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    // Second SYNC sends TPDO1 and TPDO2 last
+    if( !node.handleMessage(sync) || (bus.getCount() != 3) || (bus.getMessage().id.stid != 0x281U) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( (bus.getMessage().dlc != 1) || (bus.getMessage().data.v8[0] != 85U) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( (tpdo1.getCount() != 2U) || (tpdo2.getCount() != 1U) || (node.getSyncCount() != 2U) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    // A TPDO not taken by the bus is not counted
+    bus.setFull(true);
+    node.handleMessage(sync);
+    bus.setFull(false);
+    if( tpdo1.getCount() != 2U )
+    {   // Failure
+        TestRunner::fail();
+    }
+    // RPDO
+    if( !node.handleMessage( createMessage(0x201U, 6, 0x0000000100020006U) ) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( (rpdo1.getCount() != 1U) || (ControlWord::read(rpdo1) != 0x0006U) || (TargetPosition::read(rpdo1) != 0x00010002) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    // Short RPDO, unknown COB-ID and extended frame
+    if( node.handleMessage( createMessage(0x201U, 5, 0U) ) || (rpdo1.getCount() != 1U) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( node.handleMessage( createMessage(0x202U, 8, 0U) ) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    drv::Can::Message extended( createMessage(pcb::CanOpenNode::COB_ID_SYNC, 0, 0U) );
+    extended.ide = true;
+    if( node.handleMessage(extended) || (node.getSyncCount() != 3U) )
+    {   // Failure
+        TestRunner::fail();
+    }
+}
+
+void testCanOpenBenchmark()
+{
+    Bus bus;
+    pcb::CanOpenNode node(bus);
+    pcb::CanOpenPdo tpdo1(0x181U, Tpdo1Mapping::DLC);
+    pcb::CanOpenPdo tpdo2(0x281U, Tpdo1Mapping::DLC);
+    pcb::CanOpenPdo tpdo3(0x381U, Tpdo1Mapping::DLC);
+    pcb::CanOpenPdo tpdo4(0x481U, Tpdo1Mapping::DLC);
+    if( !node.addTpdo(tpdo1, 1U) || !node.addTpdo(tpdo2, 1U) || !node.addTpdo(tpdo3, 1U) || !node.addTpdo(tpdo4, 1U) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    drv::Can::Message const sync( createMessage(pcb::CanOpenNode::COB_ID_SYNC, 0, 0U) );
+    pcb::CanOpenNode single(bus);
+    if( !single.addTpdo(tpdo1, 1U) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    uint32_t minLatency( 0xFFFFFFFFU );
+    uint32_t maxLatency( 0U );
+    for(int32_t i(0); i<NUMBER_OF_SYNCS; i++)
+    {
+        ActualPosition::write(tpdo1, i);
+        uint32_t const start( pcb::CycleCounter::get() );
+        single.handleMessage(sync);
+        uint32_t const latency( bus.getTime() - start );
+        minLatency = (latency < minLatency) ? latency : minLatency;
+        maxLatency = (latency > maxLatency) ? latency : maxLatency;
+    }
+    int32_t const count( bus.getCount() );
+    uint32_t const start( pcb::CycleCounter::get() );
+    for(int32_t i(0); i<NUMBER_OF_SYNCS; i++)
+    {
+        ActualPosition::write(tpdo1, i);
+        StatusWord::write(tpdo1, static_cast<uint16_t>(i));
+        node.handleMessage(sync);
+    }
+    uint32_t const cycles( pcb::CycleCounter::get() - start );
+    int32_t const pdos( bus.getCount() - count );
+    if( pdos != NUMBER_OF_SYNCS * 4 )
+    {   // Failure
+        TestRunner::fail();
+    }
+    lib::Stream::cout() << "CANOPEN: SYNC-to-TPDO latency from " << static_cast<int32_t>(minLatency) << " to " << static_cast<int32_t>(maxLatency) << " cycles\r\n";
+    lib::Stream::cout() << "CANOPEN: TPDO throughput " << static_cast<int32_t>(cycles / static_cast<uint32_t>(pdos)) << " cycles\r\n";
+}
+
+} // namespace
+
+void testCanOpen()
+{
+    testCanOpenMapping();
+    testCanOpenSync();
+    testCanOpenBenchmark();
+    // Success
+}
+
+namespace
+{
+
+/**
+ * @brief Registration of the suite.
+ */
+TestSuite const suite_("can-open", testCanOpen, TestSuite::TYPE_TEST, 10000);
+
+} // namespace
+
+} // namespace eoos
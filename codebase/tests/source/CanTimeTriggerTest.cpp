@@ -0,0 +1,238 @@
+/**
+ * @file      CanTimeTriggerTest.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of CAN time-triggered communication.
+ */
+#include "CanTimeTriggerTest.hpp"
+#include "TestRunner.hpp"
+#include "drv.Can.hpp"
+#include "lib.UniquePointer.hpp"
+#include "lib.Stream.hpp"
+#include "pcb.CanTimeTrigger.hpp"
+#include "pcb.Clock.hpp"
+
+namespace eoos
+{
+namespace
+{
+
+/**
+ * @brief Number of frames received.
+ */
+const int32_t NUMBER_OF_FRAMES(300);
+
+/**
+ * @brief Number of entries of the schedule.
+ */
+const int32_t NUMBER_OF_ENTRIES(3);
+
+/**
+ * @brief Cycle of the schedule in microseconds.
+ */
+const uint32_t CYCLE( 10000U );
+
+/**
+ * @brief Bit times of the cycle at 250 Kbit/s.
+ */
+const uint32_t CYCLE_BITS( CYCLE / 4U );
+
+drv::Can::Message const messages_[NUMBER_OF_ENTRIES] = {
+    {
+        .id  = { .exid = 0, .stid = 0x100 },
+        .rtr = false,
+        .ide = false,
+        .dlc = 2,
+        .data = { .v64 = { 0x0000000000000201 } }
+    },
+    {
+        .id  = { .exid = 0b000000000000000011, .stid = 0x101 },
+        .rtr = false,
+        .ide = true,
+        .dlc = 4,
+        .data = { .v64 = { 0x0000000004030201 } }
+    },
+    {
+        .id  = { .exid = 0, .stid = 0x102 },
+        .rtr = false,
+        .ide = false,
+        .dlc = 8,
+        .data = { .v64 = { 0x0807060504030201 } }
+    }
+};
+
+pcb::CanTimeTrigger::Entry const entries_[NUMBER_OF_ENTRIES] = {
+    { .offset = 0U,    .message = &messages_[0], .isTimeSent = false },
+    { .offset = 2500U, .message = &messages_[1], .isTimeSent = false },
+    { .offset = 5000U, .message = &messages_[2], .isTimeSent = true }
+};
+
+void setFilter(drv::Can& can)
+{
+    drv::Can::RxFilter filter = {
+        .fifo = drv::Can::RxFilter::FIFO_1,
+        .index = 0,
+        .mode = drv::Can::RxFilter::MODE_IDMASK,
+        .scale = drv::Can::RxFilter::SCALE_32BIT,
+        .filters = { 
+            .group32 = {
+                .idMask = {
+                    .id = {
+                        .bit = {
+                            .rtr = 0,
+                            .ide = 0,
+                            .exid = 0b000000000000000000,
+                            .stid = 0b0000000000
+                        }
+                    },
+                    .mask = {
+                        .bit = {
+                            .rtr = 0,
+                            .ide = 0,
+                            .exid = 0b000000000000000000,
+                            .stid = 0b0000000000
+                        }
+                    }
+                }
+            }
+        }
+    };
+    if( !can.setReceiveFilter(filter) )
+    {   // Failure
+        TestRunner::fail();
+    }
+}
+
+void receive(pcb::CanTimeTrigger& trigger, pcb::CanTimeTrigger::TimedMessage* const message)
+{
+    uint64_t const timeout( pcb::Clock::getCycles() + pcb::Clock::toCycles(2U * CYCLE * 1000U) );
+    while( !trigger.receive(message) )
+    {
+        if( pcb::Clock::getCycles() > timeout )
+        {   // Failure
+            TestRunner::fail();
+        }
+    }
+}
+
+} // namespace
+
+void testCanTimeTrigger()
+{
+    drv::Can::Config config = {
+        .number = drv::Can::NUMBER_CAN1,
+        .bitRate = drv::Can::BITRATE_250,
+        .samplePoint = drv::Can::SAMPLEPOINT_CANOPEN,
+        .reg = {
+            .mcr = {
+                .txfp = 0, ///< Transmit FIFO priority (reset value is 0)
+                .rflm = 0, ///< Receive FIFO locked mode (reset value is 0)
+                .dbf  = 0  ///< CAN RX and TX frozen during debug (reset value is 1)
+            },
+            .btr = {
+                .lbkm = 1, ///< Loop back mode for debug (reset value is 0)
+                .silm = 1  ///< Silent mode for debug (reset value is 0)
+            }
+        }
+    };
+    lib::UniquePointer<drv::Can> can( drv::Can::create(config) );
+    if( can.isNull() )
+    {   // Failure
+        TestRunner::fail();
+    }
+    setFilter(*can);
+    pcb::CanTimeTrigger trigger;
+    if( !trigger.isConstructed() )
+    {   // Failure
+        TestRunner::fail();
+    }
+    pcb::CanTimeTrigger::Entry const unordered[2] = { entries_[1], entries_[0] };
+    if( trigger.start(unordered, 2, CYCLE) || trigger.start(entries_, NUMBER_OF_ENTRIES, 5000U) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( !trigger.start(entries_, NUMBER_OF_ENTRIES, CYCLE) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    uint64_t const expected( pcb::Clock::toCycles(CYCLE * 1000U) );
+    uint64_t maxJitter( 0U );
+    uint32_t last[NUMBER_OF_ENTRIES] = { 0U };
+    uint64_t lastCycles[NUMBER_OF_ENTRIES] = { 0U };
+    bool_t isLast[NUMBER_OF_ENTRIES] = { false };
+    bool_t isCorrelated[NUMBER_OF_ENTRIES] = { false };
+    int32_t index( -1 );
+    for(int32_t i(0); i<NUMBER_OF_FRAMES; i++)
+    {
+        pcb::CanTimeTrigger::TimedMessage message = { 0 };
+        receive(trigger, &message);
+        if( index < 0 )
+        {
+            // Synchronize to the first entry of the schedule
+            for(int32_t j(0); j<NUMBER_OF_ENTRIES; j++)
+            {
+                if( message.message.id.stid == messages_[j].id.stid )
+                {
+                    index = j;
+                }
+            }
+        }
+        if( (index < 0) || (message.message.id.stid != messages_[index].id.stid) || (message.message.dlc != messages_[index].dlc) )
+        {   // Failure
+            TestRunner::fail();
+        }
+        if( entries_[index].isTimeSent )
+        {
+            // The CAN time at the start of the frame is sent in the last two bytes
+            uint32_t const time( static_cast<uint32_t>(message.message.data.v8[6]) | (static_cast<uint32_t>(message.message.data.v8[7]) << 8) );
+            if( ((message.time - time) & 0xFFFFU) > 1U )
+            {   // Failure
+                TestRunner::fail();
+            }
+        }
+        else if( message.message.data.v64[0] != messages_[index].data.v64[0] )
+        {   // Failure
+            TestRunner::fail();
+        }
+        if( isLast[index] )
+        {
+            uint32_t const bits( (message.time - last[index]) & 0xFFFFU );
+            if( (bits < CYCLE_BITS - 2U) || (bits > CYCLE_BITS + 2U) )
+            {   // Failure
+                TestRunner::fail();
+            }
+            if( message.isCorrelated && isCorrelated[index] )
+            {
+                uint64_t const period( message.cycles - lastCycles[index] );
+                uint64_t const jitter( (period > expected) ? (period - expected) : (expected - period) );
+                maxJitter = (jitter > maxJitter) ? jitter : maxJitter;
+            }
+        }
+        last[index] = message.time;
+        lastCycles[index] = message.cycles;
+        isLast[index] = true;
+        isCorrelated[index] = message.isCorrelated;
+        index = (index + 1 < NUMBER_OF_ENTRIES) ? (index + 1) : 0;
+    }
+    trigger.stop();
+    if( trigger.getMissed() != 0U )
+    {   // Failure
+        TestRunner::fail();
+    }
+    lib::Stream::cout() << "CAN TTCM: Bit time " << static_cast<int32_t>( trigger.getCyclesPerBit() ) << " cycles\r\n";
+    lib::Stream::cout() << "CAN TTCM: Maximum jitter of cyclic frames " << static_cast<int32_t>(maxJitter) << " cycles\r\n";
+    // Success
+}
+
+namespace
+{
+
+/**
+ * @brief Registration of the suite.
+ */
+TestSuite const suite_("can-time-trigger", testCanTimeTrigger, TestSuite::TYPE_TEST, 30000);
+
+} // namespace
+
+} // namespace eoos
@@ -0,0 +1,279 @@
+/**
+ * @file      ClockScalerTest.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of clock frequency scaling.
+ */
+#include "ClockScalerTest.hpp"
+#include "TestRunner.hpp"
+#include "drv.Can.hpp"
+#include "lib.UniquePointer.hpp"
+#include "lib.AbstractThreadTask.hpp"
+#include "lib.Thread.hpp"
+#include "lib.Stream.hpp"
+#include "pcb.ClockScaler.hpp"
+#include "pcb.CanRetiming.hpp"
+#include "pcb.CycleCounter.hpp"
+
+namespace eoos
+{
+namespace
+{
+
+/**
+ * @brief Number of switches to each profile.
+ */
+const int32_t NUMBER_OF_SWITCHES(10);
+
+/**
+ * @brief Sleep time to check the kernel tick rate in ms.
+ */
+const int32_t SLEEP_TIME(100);
+
+void setFilter(drv::Can& can)
+{
+    drv::Can::RxFilter filter = {
+        .fifo = drv::Can::RxFilter::FIFO_1,
+        .index = 0,
+        .mode = drv::Can::RxFilter::MODE_IDMASK,
+        .scale = drv::Can::RxFilter::SCALE_32BIT,
+        .filters = { 
+            .group32 = {
+                .idMask = {
+                    .id = {
+                        .bit = {
+                            .rtr = 0,
+                            .ide = 1,
+                            .exid = 0b000000000000000000,
+                            .stid = 0b0000000000
+                        }
+                    },
+                    .mask = {
+                        .bit = {
+                            .rtr = 0,
+                            .ide = 0,
+                            .exid = 0b000000000000000000,
+                            .stid = 0b0000000000
+                        }
+                    }
+                }
+            }
+        }
+    };
+    if( !can.setReceiveFilter(filter) )
+    {   // Failure
+        TestRunner::fail();
+    }
+}
+
+/**
+ * @class Traffic
+ * @brief Thread exchanging CAN messages in loopback until it is stopped.
+ *
+ * Each message is received before the next one is transmitted, so a message lost
+ * while clocks are switched blocks the thread until the suite timeout expires.
+ */
+class Traffic : public lib::AbstractThreadTask<>
+{
+    typedef AbstractThreadTask<> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param can CAN driver to exchange messages.
+     */
+    explicit Traffic(drv::Can& can)
+        : Parent()
+        , can_( can )
+        , messages_( 0 )
+        , isStopped_( false ) {
+    }
+
+    /**
+     * @brief Stops the thread and waits for its end.
+     */
+    void stop()
+    {
+        isStopped_ = true;
+        static_cast<void>( join() );
+    }
+
+    /**
+     * @brief Returns the number of exchanged messages.
+     *
+     * @return The number.
+     */
+    int32_t getMessages() const
+    {
+        return messages_;
+    }
+
+private:
+
+    /**
+     * @copydoc eoos::api::Task::start()
+     */
+    virtual void start()
+    {
+        while( !isStopped_ )
+        {
+            drv::Can::Message txMessage = {
+                .id  = {
+                    .exid = 0b000000000000000011,
+                    .stid = 0b0000000001
+                },
+                .rtr = false,
+                .ide = true,
+                .dlc = 8,
+                .data = {
+                    .v64 = {
+                        0x0807060504030201U + static_cast<uint64_t>(messages_)
+                    }
+                }
+            };
+            if( !can_.transmit(txMessage) )
+            {   // Failure
+                TestRunner::fail();
+            }
+            drv::Can::Message rxMessage = { 0 };
+            if( !can_.receive(&rxMessage, drv::Can::RXFIFO_1) )
+            {   // Failure
+                TestRunner::fail();
+            }
+            if( txMessage != rxMessage )
+            {   // Failure
+                TestRunner::fail();
+            }
+            messages_ = messages_ + 1;
+        }
+    }
+
+    drv::Can& can_;              ///< CAN driver to exchange messages.
+    int32_t volatile messages_;  ///< Number of exchanged messages.
+    bool_t volatile isStopped_;  ///< Stop request.
+
+};
+
+void testTickRate(pcb::ClockScaler::Profile const profile)
+{
+    uint64_t const expected( static_cast<uint64_t>( pcb::ClockScaler::getFrequencies(profile).hclk ) * SLEEP_TIME / 1000U );
+    uint32_t const start( pcb::CycleCounter::get() );
+    lib::Thread<>::sleep(SLEEP_TIME);
+    uint64_t const cycles( pcb::CycleCounter::get() - start );
+    // The sleep is up to one tick longer than requested
+    if( (cycles < expected * 98U / 100U) || (cycles > expected * 103U / 100U) )
+    {   // Failure
+        TestRunner::fail();
+    }
+}
+
+uint32_t setProfile(pcb::ClockScaler& scaler, pcb::ClockScaler::Profile const profile)
+{
+    uint32_t const start( pcb::CycleCounter::get() );
+    if( !scaler.setProfile(profile) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    uint32_t const cycles( pcb::CycleCounter::get() - start );
+    if( scaler.getProfile() != profile )
+    {   // Failure
+        TestRunner::fail();
+    }
+    return cycles;
+}
+
+} // namespace
+
+void testClockScaler()
+{
+    pcb::ClockScaler* const scaler( pcb::ClockScaler::get() );
+    if( scaler == NULLPTR )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( scaler->getProfile() != pcb::ClockScaler::PROFILE_PERFORMANCE )
+    {   // Failure
+        TestRunner::fail();
+    }
+    drv::Can::Config config = {
+        .number = drv::Can::NUMBER_CAN1,
+        .bitRate = drv::Can::BITRATE_250,
+        .samplePoint = drv::Can::SAMPLEPOINT_CANOPEN,
+        .reg = {
+            .mcr = {
+                .txfp = 0, ///< Transmit FIFO priority (reset value is 0)
+                .rflm = 0, ///< Receive FIFO locked mode (reset value is 0)
+                .dbf  = 0  ///< CAN RX and TX frozen during debug (reset value is 1)
+            },
+            .btr = {
+                .lbkm = 1, ///< Loop back mode for debug (reset value is 0)
+                .silm = 1  ///< Silent mode for debug (reset value is 0)
+            }
+        }
+    };
+    lib::UniquePointer<drv::Can> can( drv::Can::create(config) );
+    if( can.isNull() )
+    {   // Failure
+        TestRunner::fail();
+    }
+    setFilter(*can);
+    pcb::CanRetiming retiming;
+    if( !scaler->addListener(retiming) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    // Messages are in flight while clocks are switched
+    Traffic traffic(*can);
+    traffic.execute();
+    uint32_t maxToLowPower( 0U );
+    uint32_t maxToPerformance( 0U );
+    for(int32_t i(0); i<NUMBER_OF_SWITCHES; i++)
+    {
+        int32_t messages( traffic.getMessages() );
+        testTickRate(pcb::ClockScaler::PROFILE_PERFORMANCE);
+        if( traffic.getMessages() == messages )
+        {   // Failure
+            TestRunner::fail();
+        }
+        uint32_t cycles( setProfile(*scaler, pcb::ClockScaler::PROFILE_LOW_POWER) );
+        maxToLowPower = (cycles > maxToLowPower) ? cycles : maxToLowPower;
+        lib::Stream::cout() << "CLOCK SCALER: Low power profile " << i << "\r\n";
+        messages = traffic.getMessages();
+        testTickRate(pcb::ClockScaler::PROFILE_LOW_POWER);
+        if( traffic.getMessages() == messages )
+        {   // Failure
+            TestRunner::fail();
+        }
+        cycles = setProfile(*scaler, pcb::ClockScaler::PROFILE_PERFORMANCE);
+        maxToPerformance = (cycles > maxToPerformance) ? cycles : maxToPerformance;
+        lib::Stream::cout() << "CLOCK SCALER: Performance profile " << i << "\r\n";
+    }
+    traffic.stop();
+    lib::Stream::cout() << "CLOCK SCALER: Exchanged " << traffic.getMessages() << " messages\r\n";
+    if( !scaler->removeListener(retiming) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( scaler->removeListener(retiming) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    lib::Stream::cout() << "CLOCK SCALER: Maximum switch to low power " << static_cast<int32_t>(maxToLowPower) << " cycles\r\n";
+    lib::Stream::cout() << "CLOCK SCALER: Maximum switch to performance " << static_cast<int32_t>(maxToPerformance) << " cycles\r\n";
+    // Success
+}
+
+namespace
+{
+
+/**
+ * @brief Registration of the suite.
+ */
+TestSuite const suite_("clock-scaler", testClockScaler, TestSuite::TYPE_TEST, 30000);
+
+} // namespace
+
+} // namespace eoos
@@ -0,0 +1,107 @@
+/**
+ * @file      ClockTest.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of monotonic high-resolution clock.
+ */
+#include "ClockTest.hpp"
+#include "TestRunner.hpp"
+#include "lib.Thread.hpp"
+#include "lib.Stream.hpp"
+#include "pcb.Clock.hpp"
+
+namespace eoos
+{
+namespace
+{
+
+const int32_t NUMBER_OF_READINGS(1000);
+const int32_t NUMBER_OF_PERIODS(100);
+const uint64_t PERIOD( pcb::Clock::FREQUENCY / 100U );
+
+void testClockConversion()
+{
+    if( pcb::Clock::toNanoseconds(pcb::Clock::FREQUENCY) != 1000000000U )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( pcb::Clock::toCycles(1000000000U) != pcb::Clock::FREQUENCY )
+    {   // Failure
+        TestRunner::fail();
+    }
+    uint64_t const cycles( static_cast<uint64_t>(pcb::Clock::FREQUENCY) * 3600U * 24U * 365U );
+    if( pcb::Clock::toCycles( pcb::Clock::toNanoseconds(cycles) ) != cycles )
+    {   // Failure
+        TestRunner::fail();
+    }
+}
+
+void testClockMonotonic()
+{
+    uint64_t last( pcb::Clock::getCycles() );
+    for(int32_t i(0); i<NUMBER_OF_READINGS; i++)
+    {
+        uint64_t const time( pcb::Clock::getCycles() );
+        if( time < last )
+        {   // Failure
+            TestRunner::fail();
+        }
+        last = time;
+    }
+    uint64_t const start( pcb::Clock::getNanoseconds() );
+    lib::Thread<>::sleep(100);
+    uint64_t const time( pcb::Clock::getNanoseconds() - start );
+    if( (time < 99000000U) || (time > 102000000U) )
+    {   // Failure
+        TestRunner::fail();
+    }
+}
+
+void testClockSleepUntil()
+{
+    uint64_t const start( pcb::Clock::getCycles() );
+    uint64_t time( start );
+    uint64_t late( 0U );
+    for(int32_t i(0); i<NUMBER_OF_PERIODS; i++)
+    {
+        time += PERIOD;
+        pcb::Clock::sleepUntil(time);
+        uint64_t const now( pcb::Clock::getCycles() );
+        if( now < time )
+        {   // Failure
+            TestRunner::fail();
+        }
+        uint64_t const lateness( now - time );
+        late = (lateness > late) ? lateness : late;
+    }
+    uint64_t const drift( pcb::Clock::getCycles() - start - PERIOD * NUMBER_OF_PERIODS );
+    if( drift > PERIOD )
+    {   // Failure
+        TestRunner::fail();
+    }
+    lib::Stream::cout() << "CLOCK: Maximum lateness of period " << static_cast<int32_t>( pcb::Clock::toNanoseconds(late) / 1000U ) << " us\r\n";
+    lib::Stream::cout() << "CLOCK: Drift of " << NUMBER_OF_PERIODS << " periods " << static_cast<int32_t>( pcb::Clock::toNanoseconds(drift) / 1000U ) << " us\r\n";
+}
+
+} // namespace
+
+void testClock()
+{
+    testClockConversion();
+    testClockMonotonic();
+    testClockSleepUntil();
+    // Success
+}
+
+namespace
+{
+
+/**
+ * @brief Registration of the suite.
+ */
+TestSuite const suite_("clock", testClock, TestSuite::TYPE_TEST, 10000);
+
+} // namespace
+
+} // namespace eoos
@@ -6,6 +6,7 @@
  * @brief Tests of contex switch.
  */
 #include "ContexSwitchTest.hpp"
+#include "TestSuite.hpp"
 #include "lib.AbstractThreadTask.hpp"
 
 namespace eoos
@@ -76,4 +77,14 @@ void testContexSwitch()
     lockOnContex1();
 }
 
+namespace
+{
+
+/**
+ * @brief Registration of the suite.
+ */
+TestSuite const suite_("context-switch", testContexSwitch, TestSuite::TYPE_MANUAL, TestSuite::TIMEOUT_INFINITE);
+
+} // namespace
+
 } // namespace eoos
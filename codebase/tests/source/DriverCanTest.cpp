@@ -6,6 +6,7 @@
  * @brief Tests of CAN driver.
  */
 #include "DriverCanTest.hpp"
+#include "TestSuite.hpp"
 #include "drv.Can.hpp"
 #include "lib.UniquePointer.hpp"
 #include "lib.AbstractThreadTask.hpp"
@@ -367,4 +368,14 @@ void testDriverCan()
     while(true);
 }
 
+namespace
+{
+
+/**
+ * @brief Registration of the suite.
+ */
+TestSuite const suite_("driver-can", testDriverCan, TestSuite::TYPE_MANUAL, TestSuite::TIMEOUT_INFINITE);
+
+} // namespace
+
 } // namespace eoos
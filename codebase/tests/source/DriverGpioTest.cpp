@@ -6,6 +6,7 @@
  * @brief Tests of GPIO driver.
  */
 #include "DriverGpioTest.hpp"
+#include "TestSuite.hpp"
 #include "drv.Gpio.hpp"
 #include "lib.Thread.hpp"
 #include "lib.UniquePointer.hpp"
@@ -41,4 +42,14 @@ void testDriverGpio()
     }
 }
 
+namespace
+{
+
+/**
+ * @brief Registration of the suite.
+ */
+TestSuite const suite_("driver-gpio", testDriverGpio, TestSuite::TYPE_MANUAL, TestSuite::TIMEOUT_INFINITE);
+
+} // namespace
+
 } // namespace eoos
@@ -6,6 +6,7 @@
  * @brief Tests of Null driver.
  */
 #include "DriverNullTest.hpp"
+#include "TestSuite.hpp"
 #include "drv.Null.hpp"
 #include "lib.UniquePointer.hpp"
 
@@ -21,4 +22,14 @@ void testDriverNull()
     *uart << "Hello, World!" << "\r\n";
 }
 
+namespace
+{
+
+/**
+ * @brief Registration of the suite.
+ */
+TestSuite const suite_("driver-null", testDriverNull, TestSuite::TYPE_TEST, 10000);
+
+} // namespace
+
 } // namespace eoos
@@ -6,6 +6,7 @@
  * @brief Tests of USART driver.
  */
 #include "DriverUsartTest.hpp"
+#include "TestSuite.hpp"
 #include "drv.Usart.hpp"
 #include "lib.UniquePointer.hpp"
 
@@ -27,4 +28,14 @@ void testDriverUsart()
     *uart << "Hello, World!" << "\r\n";
 }
 
+namespace
+{
+
+/**
+ * @brief Registration of the suite.
+ */
+TestSuite const suite_("driver-usart", testDriverUsart, TestSuite::TYPE_MANUAL, TestSuite::TIMEOUT_INFINITE);
+
+} // namespace
+
 } // namespace eoos
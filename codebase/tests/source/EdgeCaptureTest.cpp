@@ -0,0 +1,137 @@
+/**
+ * @file      EdgeCaptureTest.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of GPIO edge capture.
+ */
+#include "EdgeCaptureTest.hpp"
+#include "TestRunner.hpp"
+#include "lib.Stream.hpp"
+#include "pcb.EdgeCapture.hpp"
+#include "pcb.CycleCounter.hpp"
+
+namespace eoos
+{
+namespace
+{
+
+const int32_t NUMBER_OF_EDGES(1000);
+const int32_t BATCH(4);
+
+void testEdgeCaptureBatch(pcb::EdgeCapture& capture)
+{
+    pcb::EdgeCapture::Event events[BATCH];
+    if( capture.read(events, BATCH, 10) != 0 )
+    {   // Failure
+        TestRunner::fail();
+    }
+    uint32_t times[BATCH];
+    for(int32_t i(0); i<BATCH; i++)
+    {
+        times[i] = pcb::CycleCounter::get();
+        capture.generate();
+    }
+    if( capture.read(events, BATCH, pcb::EdgeCapture::TIMEOUT_INFINITE) != BATCH )
+    {   // Failure
+        TestRunner::fail();
+    }
+    for(int32_t i(0); i<BATCH; i++)
+    {
+        if( static_cast<int32_t>(events[i].time - times[i]) < 0 )
+        {   // Failure
+            TestRunner::fail();
+        }
+    }
+}
+
+void testEdgeCaptureOverflow(pcb::EdgeCapture& capture)
+{
+    uint32_t const lost( capture.getLost() );
+    for(int32_t i(0); i<pcb::EdgeCapture::CAPACITY + BATCH; i++)
+    {
+        capture.generate();
+    }
+    if( capture.getLost() - lost != static_cast<uint32_t>(BATCH) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    pcb::EdgeCapture::Event events[pcb::EdgeCapture::CAPACITY];
+    if( capture.read(events, pcb::EdgeCapture::CAPACITY, 0) != pcb::EdgeCapture::CAPACITY )
+    {   // Failure
+        TestRunner::fail();
+    }
+}
+
+void benchmarkEdgeCapture(pcb::EdgeCapture& capture)
+{
+    uint32_t min( 0xFFFFFFFFU );
+    uint32_t max( 0U );
+    uint32_t sum( 0U );
+    for(int32_t i(0); i<NUMBER_OF_EDGES; i+=BATCH)
+    {
+        pcb::EdgeCapture::Event events[BATCH];
+        uint32_t times[BATCH];
+        for(int32_t j(0); j<BATCH; j++)
+        {
+            times[j] = pcb::CycleCounter::get();
+            capture.generate();
+        }
+        if( capture.read(events, BATCH, pcb::EdgeCapture::TIMEOUT_INFINITE) != BATCH )
+        {   // Failure
+            TestRunner::fail();
+        }
+        for(int32_t j(0); j<BATCH; j++)
+        {
+            uint32_t const latency( events[j].time - times[j] );
+            min = (latency < min) ? latency : min;
+            max = (latency > max) ? latency : max;
+            sum += latency;
+        }
+    }
+    lib::Stream::cout() << "EXTI: Minimum latency of edge " << static_cast<int32_t>(min) << " cycles\r\n";
+    lib::Stream::cout() << "EXTI: Average latency of edge " << static_cast<int32_t>(sum / NUMBER_OF_EDGES) << " cycles\r\n";
+    lib::Stream::cout() << "EXTI: Maximum latency of edge " << static_cast<int32_t>(max) << " cycles\r\n";
+}
+
+} // namespace
+
+void testEdgeCapture()
+{
+    pcb::EdgeCapture::Config config = {
+        .port = pcb::GpioPort::NUMBER_A,
+        .pin = 0,
+        .edge = pcb::EdgeCapture::EDGE_BOTH,
+        .pull = true,
+        .batch = BATCH
+    };
+    pcb::EdgeCapture capture( config );
+    if( !capture.isConstructed() )
+    {   // Failure
+        TestRunner::fail();
+    }
+    testEdgeCaptureBatch(capture);
+    testEdgeCaptureOverflow(capture);
+    {
+        config.batch = 1;
+        pcb::EdgeCapture busy( config );
+        if( busy.isConstructed() )
+        {   // Failure
+            TestRunner::fail();
+        }
+    }
+    benchmarkEdgeCapture(capture);
+    // Success
+}
+
+namespace
+{
+
+/**
+ * @brief Registration of the suite.
+ */
+TestSuite const suite_("edge-capture", testEdgeCapture, TestSuite::TYPE_TEST, 30000);
+
+} // namespace
+
+} // namespace eoos
@@ -0,0 +1,129 @@
+/**
+ * @file      EventGroupTest.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of event group.
+ */
+#include "EventGroupTest.hpp"
+#include "TestRunner.hpp"
+#include "lib.AbstractThreadTask.hpp"
+#include "lib.Thread.hpp"
+#include "pcb.EventGroup.hpp"
+
+namespace eoos
+{
+namespace
+{
+
+/**
+ * @class Producer
+ * @brief Thread raising an event after a delay.
+ */
+class Producer : public lib::AbstractThreadTask<>
+{
+    typedef AbstractThreadTask<> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param flag  Event to raise.
+     * @param delay Delay in milliseconds before raising.
+     */
+    Producer(pcb::EventFlag& flag, int32_t delay) : Parent(),
+        flag_ (flag),
+        delay_ (delay){
+    }
+
+private:
+
+    /**
+     * @copydoc eoos::api::Task::start()
+     */
+    virtual void start()
+    {
+        lib::Thread<>::sleep(delay_);
+        bool_t const res( flag_.raise() );
+        if( res == false )
+        {   // Failure
+            TestRunner::fail();
+        }
+    }
+
+    pcb::EventFlag& flag_; ///< Event to raise.
+    int32_t delay_;        ///< Delay in milliseconds before raising.
+};
+
+void testWaitTimeout(pcb::EventGroup& group)
+{
+    uint32_t const bits( group.waitAny(0x00000003U, 10) );
+    if( bits != 0U )
+    {   // Failure
+        TestRunner::fail();
+    }
+}
+
+void testWaitAny(pcb::EventGroup& group)
+{
+    pcb::EventFlag flagCan(group, 0);
+    pcb::EventFlag flagUsart(group, 1);
+    Producer producer(flagUsart, 10);
+    producer.execute();
+    uint32_t const bits( group.waitAny(flagCan.getMask() | flagUsart.getMask(), 1000) );
+    if( bits != flagUsart.getMask() )
+    {   // Failure
+        TestRunner::fail();
+    }
+    producer.join();
+    if( group.getBits() != 0U )
+    {   // Failure
+        TestRunner::fail();
+    }
+}
+
+void testWaitAll(pcb::EventGroup& group)
+{
+    pcb::EventFlag flagCan(group, 0);
+    pcb::EventFlag flagUsart(group, 1);
+    Producer producerCan(flagCan, 10);
+    Producer producerUsart(flagUsart, 20);
+    producerCan.execute();
+    producerUsart.execute();
+    uint32_t const mask( flagCan.getMask() | flagUsart.getMask() );
+    uint32_t const bits( group.waitAll(mask, 1000) );
+    if( bits != mask )
+    {   // Failure
+        TestRunner::fail();
+    }
+    producerCan.join();
+    producerUsart.join();
+}
+
+} // namespace
+
+void testEventGroup()
+{
+    pcb::EventGroup group;
+    if( !group.isConstructed() )
+    {   // Failure
+        TestRunner::fail();
+    }
+    testWaitTimeout(group);
+    testWaitAny(group);
+    testWaitAll(group);
+    // Success
+}
+
+namespace
+{
+
+/**
+ * @brief Registration of the suite.
+ */
+TestSuite const suite_("event-group", testEventGroup, TestSuite::TYPE_TEST, 30000);
+
+} // namespace
+
+} // namespace eoos
@@ -0,0 +1,302 @@
+/**
+ * @file      ExecutorTest.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of executor.
+ */
+#include "ExecutorTest.hpp"
+#include "TestRunner.hpp"
+#include "lib.AbstractThreadTask.hpp"
+#include "lib.Thread.hpp"
+#include "lib.Stream.hpp"
+#include "pcb.Executor.hpp"
+#include "pcb.CycleCounter.hpp"
+
+namespace eoos
+{
+namespace
+{
+
+const int32_t NUMBER_OF_JOBS(100);
+
+/**
+ * @brief Number of jobs run by all the executors.
+ */
+int32_t executions_(0);
+
+/**
+ * @class CountJob
+ * @brief Job counting its executions and its start latency.
+ */
+class CountJob : public pcb::Job
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    CountJob() : pcb::Job(),
+        count_ (0),
+        order_ (-1),
+        submitted_ (0U),
+        latency_ (0U){
+    }
+
+    /**
+     * @brief Marks time of the job submission.
+     */
+    void mark()
+    {
+        submitted_ = pcb::CycleCounter::get();
+    }
+
+    /**
+     * @brief Returns number of executions.
+     *
+     * @return Number of executions.
+     */
+    int32_t getCount() const
+    {
+        return count_;
+    }
+
+    /**
+     * @brief Returns sequence number of the last execution among all the jobs.
+     *
+     * @return Sequence number, or -1 if the job has not been executed.
+     */
+    int32_t getOrder() const
+    {
+        return order_;
+    }
+
+    /**
+     * @brief Returns sum of start latencies.
+     *
+     * @return Cycles.
+     */
+    uint32_t getLatency() const
+    {
+        return latency_;
+    }
+
+protected:
+
+    /**
+     * @copydoc eoos::pcb::Job::run()
+     */
+    virtual void run()
+    {
+        latency_ += pcb::CycleCounter::get() - submitted_;
+        order_ = executions_++;
+        count_++;
+    }
+
+private:
+
+    int32_t count_;      ///< Number of executions.
+    int32_t order_;      ///< Sequence number of the last execution.
+    uint32_t submitted_; ///< Cycles of the last submission.
+    uint32_t latency_;   ///< Sum of start latencies.
+};
+
+/**
+ * @class BlockJob
+ * @brief Job blocking its worker until it is released.
+ */
+class BlockJob : public pcb::Job
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    BlockJob() : pcb::Job(),
+        isRunning_ (false),
+        isReleased_ (false){
+    }
+
+    /**
+     * @brief Tests if a worker runs the job.
+     *
+     * @return true if the job is running.
+     */
+    bool_t isRunning() const
+    {
+        return isRunning_;
+    }
+
+    /**
+     * @brief Releases the worker.
+     */
+    void release()
+    {
+        isReleased_ = true;
+    }
+
+protected:
+
+    /**
+     * @copydoc eoos::pcb::Job::run()
+     */
+    virtual void run()
+    {
+        isRunning_ = true;
+        while( !isReleased_ )
+        {
+            lib::Thread<>::sleep(1);
+        }
+    }
+
+private:
+
+    bool_t volatile isRunning_;  ///< A worker runs the job.
+    bool_t volatile isReleased_; ///< The worker is released.
+};
+
+/**
+ * @class JobThread
+ * @brief Thread executing one job.
+ */
+class JobThread : public lib::AbstractThreadTask<>
+{
+    typedef AbstractThreadTask<> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param job Job to execute.
+     */
+    explicit JobThread(CountJob& job) : Parent(),
+        job_ (job){
+    }
+
+private:
+
+    /**
+     * @copydoc eoos::api::Task::start()
+     */
+    virtual void start()
+    {
+        job_.execute();
+    }
+
+    CountJob& job_; ///< Job to execute.
+};
+
+void testExecutorLanes()
+{
+    CountJob jobs[3];
+    BlockJob block;
+    pcb::Executor<1,4> executor;
+    if( !executor.isConstructed() )
+    {   // Failure
+        TestRunner::fail();
+    }
+    // Block the only worker, so that the jobs are queued before any of them is run
+    if( !executor.submit(block) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    while( !block.isRunning() )
+    {
+        lib::Thread<>::sleep(1);
+    }
+    if( !executor.submit(jobs[0], pcb::Executor<1,4>::LANE_LOW) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( !executor.submit(jobs[1], pcb::Executor<1,4>::LANE_HIGH) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( !executor.submit(jobs[2], pcb::Executor<1,4>::LANE_NORMAL) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    block.release();
+    if( !block.wait(1000) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    for(int32_t i(0); i<3; i++)
+    {
+        if( !jobs[i].wait(1000) )
+        {   // Failure
+            TestRunner::fail();
+        }
+    }
+    // The high lane is run before the normal lane, and the normal lane before the low lane
+    if( (jobs[1].getOrder() > jobs[2].getOrder()) || (jobs[2].getOrder() > jobs[0].getOrder()) )
+    {   // Failure
+        TestRunner::fail();
+    }
+}
+
+void benchmarkExecutor()
+{
+    CountJob job;
+    int32_t executorCycles( 0 );
+    {
+        pcb::Executor<2,4> executor;
+        uint32_t const start( pcb::CycleCounter::get() );
+        for(int32_t i(0); i<NUMBER_OF_JOBS; i++)
+        {
+            job.mark();
+            if( !executor.submit(job) || !job.wait() )
+            {   // Failure
+                TestRunner::fail();
+            }
+        }
+        executorCycles = static_cast<int32_t>( (pcb::CycleCounter::get() - start) / NUMBER_OF_JOBS );
+    }
+    int32_t const executorLatency( static_cast<int32_t>(job.getLatency() / NUMBER_OF_JOBS) );
+    CountJob threadJob;
+    uint32_t const start( pcb::CycleCounter::get() );
+    for(int32_t i(0); i<NUMBER_OF_JOBS; i++)
+    {
+        JobThread thread(threadJob);
+        threadJob.mark();
+        if( !threadJob.prepare() || !thread.execute() || !threadJob.wait() )
+        {   // Failure
+            TestRunner::fail();
+        }
+        thread.join();
+    }
+    int32_t const threadCycles( static_cast<int32_t>( (pcb::CycleCounter::get() - start) / NUMBER_OF_JOBS ) );
+    int32_t const threadLatency( static_cast<int32_t>(threadJob.getLatency() / NUMBER_OF_JOBS) );
+    if( (job.getCount() != NUMBER_OF_JOBS) || (threadJob.getCount() != NUMBER_OF_JOBS) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    lib::Stream::cout() << "EXECUTOR: Job of executor " << executorCycles << " cycles\r\n";
+    lib::Stream::cout() << "EXECUTOR: Job of thread " << threadCycles << " cycles\r\n";
+    lib::Stream::cout() << "EXECUTOR: Latency of executor " << executorLatency << " cycles\r\n";
+    lib::Stream::cout() << "EXECUTOR: Latency of thread " << threadLatency << " cycles\r\n";
+}
+
+} // namespace
+
+void testExecutor()
+{
+    testExecutorLanes();
+    benchmarkExecutor();
+    // Success
+}
+
+namespace
+{
+
+/**
+ * @brief Registration of the suite.
+ */
+TestSuite const suite_("executor", testExecutor, TestSuite::TYPE_TEST, 30000);
+
+} // namespace
+
+} // namespace eoos
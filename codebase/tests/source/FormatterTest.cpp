@@ -0,0 +1,328 @@
+/**
+ * @file      FormatterTest.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of buffered formatter.
+ */
+#include "FormatterTest.hpp"
+#include "TestRunner.hpp"
+#include "lib.Stream.hpp"
+#include "pcb.Formatter.hpp"
+#include "pcb.CycleCounter.hpp"
+
+namespace eoos
+{
+namespace
+{
+
+const int32_t NUMBER_OF_INTEGERS(1000);
+const int32_t NUMBER_OF_LINES(20);
+
+/**
+ * @brief Minimum value of 32-bit signed integer.
+ */
+const int32_t MINIMUM_INT32( static_cast<int32_t>(0x80000000U) );
+
+/**
+ * @brief Minimum value of 64-bit signed integer.
+ */
+const int64_t MINIMUM_INT64( static_cast<int64_t>(0x8000000000000000ULL) );
+
+/**
+ * @class Output
+ * @brief Output stream which keeps the text written and counts the writes.
+ */
+class Output : public api::OutStream<char_t>
+{
+
+public:
+
+    /**
+     * @brief Size of the text in characters.
+     */
+    static const int32_t SIZE = pcb::Formatter::BUFFER_SIZE + 16;
+
+    /**
+     * @brief Constructor.
+     */
+    Output()
+        : api::OutStream<char_t>()
+        , length_( 0 )
+        , writes_( 0 )
+        , text_() {
+    }
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const
+    {
+        return true;
+    }
+
+    /**
+     * @copydoc eoos::api::OutStream::operator<<(T const*)
+     */
+    virtual api::OutStream<char_t>& operator<<(char_t const* source)
+    {
+        while( (*source != '\0') && (length_ < SIZE) )
+        {
+            text_[length_++] = *source++;
+        }
+        text_[length_] = '\0';
+        writes_++;
+        return *this;
+    }
+
+    /**
+     * @copydoc eoos::api::OutStream::operator<<(int32_t)
+     */
+    virtual api::OutStream<char_t>& operator<<(int32_t)
+    {
+        return *this;
+    }
+
+    /**
+     * @copydoc eoos::api::OutStream::flush()
+     */
+    virtual api::OutStream<char_t>& flush()
+    {
+        return *this;
+    }
+
+    /**
+     * @brief Returns the text written.
+     *
+     * @return Null-terminated text.
+     */
+    char_t const* getText() const
+    {
+        return text_;
+    }
+
+    /**
+     * @brief Returns number of the writes.
+     *
+     * @return Number of the writes.
+     */
+    int32_t getWrites() const
+    {
+        return writes_;
+    }
+
+    /**
+     * @brief Drops the text written and resets the counter of the writes.
+     */
+    void clear()
+    {
+        length_ = 0;
+        writes_ = 0;
+        text_[0] = '\0';
+    }
+
+private:
+
+    int32_t length_;        ///< Length of the text.
+    int32_t writes_;        ///< Number of the writes.
+    char_t text_[SIZE + 1]; ///< The text with the terminating null character.
+};
+
+bool_t isEqual(char_t const* string, int32_t const length, char_t const* expected)
+{
+    int32_t i( 0 );
+    while( (i < length) && (string[i] == expected[i]) )
+    {
+        i++;
+    }
+    return (i == length) && (expected[i] == '\0');
+}
+
+void testFormatterConversion()
+{
+    char_t string[pcb::Formatter::NUMBER_SIZE];
+    if( !isEqual(string, pcb::Formatter::toDecimal(static_cast<uint32_t>(0U), string), "0") )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( !isEqual(string, pcb::Formatter::toDecimal(static_cast<uint32_t>(4294967295U), string), "4294967295") )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( !isEqual(string, pcb::Formatter::toDecimal(static_cast<uint32_t>(1000000007U), string), "1000000007") )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( !isEqual(string, pcb::Formatter::toDecimal(static_cast<uint64_t>(4294967296ULL), string), "4294967296") )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( !isEqual(string, pcb::Formatter::toDecimal(static_cast<uint64_t>(18446744073709551615ULL), string), "18446744073709551615") )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( !isEqual(string, pcb::Formatter::toHexadecimal(0xBEEFU, 8, string), "0000BEEF") )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( !isEqual(string, pcb::Formatter::toHexadecimal(0xDEADBEEFU, 2, string), "DEADBEEF") )
+    {   // Failure
+        TestRunner::fail();
+    }
+}
+
+bool_t isEqual(char_t const* string, char_t const* expected)
+{
+    int32_t length( 0 );
+    while( string[length] != '\0' )
+    {
+        length++;
+    }
+    return isEqual(string, length, expected);
+}
+
+void testFormatterSigned()
+{
+    Output output;
+    {
+        pcb::Formatter formatter( output );
+        formatter << static_cast<int32_t>(0) << " " << static_cast<int32_t>(-1) << " " << static_cast<int32_t>(-2147483647) << " " << MINIMUM_INT32;
+    }
+    if( !isEqual(output.getText(), "0 -1 -2147483647 -2147483648") )
+    {   // Failure
+        TestRunner::fail();
+    }
+    output.clear();
+    {
+        pcb::Formatter formatter( output );
+        formatter << static_cast<int64_t>(-1) << " " << static_cast<int64_t>(-4294967296LL) << " " << MINIMUM_INT64;
+    }
+    if( !isEqual(output.getText(), "-1 -4294967296 -9223372036854775808") )
+    {   // Failure
+        TestRunner::fail();
+    }
+}
+
+void testFormatterBuffer()
+{
+    Output output;
+    pcb::Formatter formatter( output );
+    formatter << "Line\r\n" << "Rest";
+    // The line is written at its end, and the rest is kept
+    if( (output.getWrites() != 1) || !isEqual(output.getText(), "Line\r\n") )
+    {   // Failure
+        TestRunner::fail();
+    }
+    output.clear();
+    static_cast<void>( formatter.flush() );
+    if( (output.getWrites() != 1) || !isEqual(output.getText(), "Rest") )
+    {   // Failure
+        TestRunner::fail();
+    }
+    static_cast<void>( formatter.flush() );
+    if( output.getWrites() != 1 )
+    {   // Failure as an empty buffer is written
+        TestRunner::fail();
+    }
+    output.clear();
+    for(int32_t i(0); i<pcb::Formatter::BUFFER_SIZE + 10; i++)
+    {
+        formatter << static_cast<char_t>('0' + i % 10);
+    }
+    // The full buffer is written when one more character is put
+    if( output.getWrites() != 1 )
+    {   // Failure
+        TestRunner::fail();
+    }
+    static_cast<void>( formatter.flush() );
+    char_t const* const text( output.getText() );
+    int32_t length( 0 );
+    while( text[length] != '\0' )
+    {
+        if( text[length] != static_cast<char_t>('0' + length % 10) )
+        {   // Failure
+            TestRunner::fail();
+        }
+        length++;
+    }
+    if( (output.getWrites() != 2) || (length != pcb::Formatter::BUFFER_SIZE + 10) )
+    {   // Failure
+        TestRunner::fail();
+    }
+}
+
+void benchmarkFormatterConversion()
+{
+    char_t string[pcb::Formatter::NUMBER_SIZE];
+    uint32_t value( 0x9E3779B9U );
+    uint32_t start( pcb::CycleCounter::get() );
+    for(int32_t i(0); i<NUMBER_OF_INTEGERS; i++)
+    {
+        static_cast<void>( pcb::Formatter::toDecimal(value, string) );
+        value = value * 1664525U + 1013904223U;
+    }
+    int32_t const decimal32( static_cast<int32_t>( (pcb::CycleCounter::get() - start) / NUMBER_OF_INTEGERS ) );
+    uint64_t value64( 0x9E3779B97F4A7C15ULL );
+    start = pcb::CycleCounter::get();
+    for(int32_t i(0); i<NUMBER_OF_INTEGERS; i++)
+    {
+        static_cast<void>( pcb::Formatter::toDecimal(value64, string) );
+        value64 = value64 * 6364136223846793005ULL + 1442695040888963407ULL;
+    }
+    int32_t const decimal64( static_cast<int32_t>( (pcb::CycleCounter::get() - start) / NUMBER_OF_INTEGERS ) );
+    start = pcb::CycleCounter::get();
+    for(int32_t i(0); i<NUMBER_OF_INTEGERS; i++)
+    {
+        static_cast<void>( pcb::Formatter::toHexadecimal(value, 8, string) );
+        value = value * 1664525U + 1013904223U;
+    }
+    int32_t const hexadecimal( static_cast<int32_t>( (pcb::CycleCounter::get() - start) / NUMBER_OF_INTEGERS ) );
+    pcb::Formatter formatter( lib::Stream::cout() );
+    formatter << "FORMATTER: Decimal of 32-bit integer " << decimal32 << " cycles\r\n";
+    formatter << "FORMATTER: Decimal of 64-bit integer " << decimal64 << " cycles\r\n";
+    formatter << "FORMATTER: Hexadecimal of integer " << hexadecimal << " cycles\r\n";
+}
+
+void benchmarkFormatterLine()
+{
+    api::OutStream<char_t>& stream( lib::Stream::cout() );
+    uint32_t start( pcb::CycleCounter::get() );
+    for(int32_t i(0); i<NUMBER_OF_LINES; i++)
+    {
+        stream << "FORMATTER: Line " << i << " of " << NUMBER_OF_LINES << "\r\n";
+    }
+    int32_t const direct( static_cast<int32_t>( (pcb::CycleCounter::get() - start) / NUMBER_OF_LINES ) );
+    pcb::Formatter formatter( stream );
+    start = pcb::CycleCounter::get();
+    for(int32_t i(0); i<NUMBER_OF_LINES; i++)
+    {
+        formatter << "FORMATTER: Line " << i << " of " << NUMBER_OF_LINES << "\r\n";
+    }
+    int32_t const buffered( static_cast<int32_t>( (pcb::CycleCounter::get() - start) / NUMBER_OF_LINES ) );
+    formatter << "FORMATTER: Line of direct output " << direct << " cycles\r\n";
+    formatter << "FORMATTER: Line of buffered output " << buffered << " cycles\r\n";
+}
+
+} // namespace
+
+void testFormatter()
+{
+    testFormatterConversion();
+    testFormatterSigned();
+    testFormatterBuffer();
+    benchmarkFormatterConversion();
+    benchmarkFormatterLine();
+    // Success
+}
+
+namespace
+{
+
+/**
+ * @brief Registration of the suite.
+ */
+TestSuite const suite_("formatter", testFormatter, TestSuite::TYPE_TEST, 10000);
+
+} // namespace
+
+} // namespace eoos
@@ -0,0 +1,118 @@
+/**
+ * @file      GpioPortTest.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of port-wide GPIO access.
+ */
+#include "GpioPortTest.hpp"
+#include "TestRunner.hpp"
+#include "drv.Gpio.hpp"
+#include "lib.UniquePointer.hpp"
+#include "lib.Stream.hpp"
+#include "pcb.GpioPort.hpp"
+#include "pcb.CycleCounter.hpp"
+
+namespace eoos
+{
+namespace
+{
+
+const int32_t NUMBER_OF_OPERATIONS(1000);
+
+/**
+ * @brief LED1 on PB1 of the board.
+ */
+typedef pcb::GpioPins<pcb::GpioPort::NUMBER_B, 0x0002U> Led;
+
+void testGpioPortAccess(pcb::GpioPort& port)
+{
+    port.set(Led::MASK);
+    if( (port.readOutput() & Led::MASK) == 0U )
+    {   // Failure
+        TestRunner::fail();
+    }
+    port.toggle(Led::MASK);
+    if( (port.readOutput() & Led::MASK) != 0U )
+    {   // Failure
+        TestRunner::fail();
+    }
+    port.write(Led::MASK, 0xFFFFU);
+    if( (port.read() & Led::MASK) == 0U )
+    {   // Failure
+        TestRunner::fail();
+    }
+    Led::clear();
+    if( Led::read() != 0U )
+    {   // Failure
+        TestRunner::fail();
+    }
+    Led::toggle();
+    if( Led::read() != Led::MASK )
+    {   // Failure
+        TestRunner::fail();
+    }
+}
+
+void benchmarkGpioPort(drv::Gpio& gpio, pcb::GpioPort& port)
+{
+    uint32_t start( pcb::CycleCounter::get() );
+    for(int32_t i(0); i<NUMBER_OF_OPERATIONS; i++)
+    {
+        gpio.pullUp();
+        gpio.pullDown();
+    }
+    int32_t const driverCycles( static_cast<int32_t>( (pcb::CycleCounter::get() - start) / (NUMBER_OF_OPERATIONS * 2) ) );
+    start = pcb::CycleCounter::get();
+    for(int32_t i(0); i<NUMBER_OF_OPERATIONS; i++)
+    {
+        port.set(Led::MASK);
+        port.clear(Led::MASK);
+    }
+    int32_t const portCycles( static_cast<int32_t>( (pcb::CycleCounter::get() - start) / (NUMBER_OF_OPERATIONS * 2) ) );
+    start = pcb::CycleCounter::get();
+    for(int32_t i(0); i<NUMBER_OF_OPERATIONS; i++)
+    {
+        Led::set();
+        Led::clear();
+    }
+    int32_t const pinsCycles( static_cast<int32_t>( (pcb::CycleCounter::get() - start) / (NUMBER_OF_OPERATIONS * 2) ) );
+    lib::Stream::cout() << "GPIO: Operation of driver " << driverCycles << " cycles\r\n";
+    lib::Stream::cout() << "GPIO: Operation of port " << portCycles << " cycles\r\n";
+    lib::Stream::cout() << "GPIO: Operation of pins " << pinsCycles << " cycles\r\n";
+}
+
+} // namespace
+
+void testGpioPort()
+{
+    drv::Gpio::Config config = {
+        .mode = drv::Gpio::MODE_OUTPUT_50MHZ,
+        .direction = { 
+            .output = drv::Gpio::MODEOUTPUT_PUSH_PULL
+        },
+        .port = drv::Gpio::PORTNUMBER_B,
+        .gpio = drv::Gpio::GPIONUMBER_1
+    };
+    lib::UniquePointer<drv::Gpio> gpio( drv::Gpio::create(config) );
+    if( gpio.isNull() )
+    {   // Failure
+        TestRunner::fail();
+    }
+    pcb::GpioPort port( pcb::GpioPort::NUMBER_B );
+    testGpioPortAccess(port);
+    benchmarkGpioPort(*gpio, port);
+    // Success
+}
+
+namespace
+{
+
+/**
+ * @brief Registration of the suite.
+ */
+TestSuite const suite_("gpio-port", testGpioPort, TestSuite::TYPE_TEST, 30000);
+
+} // namespace
+
+} // namespace eoos
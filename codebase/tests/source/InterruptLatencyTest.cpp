@@ -0,0 +1,504 @@
+/**
+ * @file      InterruptLatencyTest.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of interrupt latency and jitter under load.
+ */
+#include "InterruptLatencyTest.hpp"
+#include "TestRunner.hpp"
+#include "drv.Can.hpp"
+#include "drv.Usart.hpp"
+#include "lib.UniquePointer.hpp"
+#include "lib.AbstractThreadTask.hpp"
+#include "lib.Thread.hpp"
+#include "lib.Mutex.hpp"
+#include "lib.Guard.hpp"
+#include "lib.Stream.hpp"
+#include "pcb.StaticInterrupt.hpp"
+#include "pcb.CycleCounter.hpp"
+#include "FreeRTOS.h"
+
+namespace eoos
+{
+namespace
+{
+
+/**
+ * @brief Number of interrupts of a scenario.
+ */
+const int32_t NUMBER_OF_SAMPLES(20000);
+
+/**
+ * @brief Period of the interrupts in timer ticks of 72 MHz, which is 100 us.
+ */
+const uint32_t PERIOD( 7200U );
+
+/**
+ * @brief Number of bins of the histograms of one cycle, and the last bin for longer values.
+ */
+const int32_t NUMBER_OF_BINS(512);
+
+/**
+ * @brief Part of samples in tenths of percent, which must have latency less than the last bin.
+ *
+ * The rest of 0.1% is a margin for rare delays, like a long critical section of the kernel
+ * or a flash wait state stall, so that a single delayed interrupt does not fail the suite.
+ */
+const int32_t LATENCY_PERMILLE(999);
+
+/**
+ * @struct Tim
+ * @brief General-purpose timer registers used.
+ */
+struct Tim
+{
+    uint32_t volatile cr1;   ///< Control register 1.
+    uint32_t volatile cr2;   ///< Control register 2.
+    uint32_t volatile smcr;  ///< Slave mode control register.
+    uint32_t volatile dier;  ///< DMA/interrupt enable register.
+    uint32_t volatile sr;    ///< Status register.
+    uint32_t volatile egr;   ///< Event generation register.
+    uint32_t volatile ccmr1; ///< Capture/compare mode register 1.
+    uint32_t volatile ccmr2; ///< Capture/compare mode register 2.
+    uint32_t volatile ccer;  ///< Capture/compare enable register.
+    uint32_t volatile cnt;   ///< Counter.
+    uint32_t volatile psc;   ///< Prescaler.
+    uint32_t volatile arr;   ///< Auto-reload register.
+    uint32_t volatile res;   ///< Reserved.
+    uint32_t volatile ccr1;  ///< Capture/compare register 1.
+};
+
+const uint32_t ADDRESS_TIM3( 0x40000400U );       ///< Address of TIM3 registers.
+const uint32_t ADDRESS_RCC_APB1ENR( 0x4002101CU ); ///< Address of RCC APB1 peripheral clock enable register.
+const uint32_t APB1ENR_TIM3EN( 0x00000002U );      ///< APB1ENR bit of TIM3 clock.
+const uint32_t TIM_CR1_CEN( 0x00000001U );         ///< Counter enable.
+const uint32_t TIM_DIER_CC1IE( 0x00000002U );      ///< Capture/compare 1 interrupt enable.
+const uint32_t TIM_SR_CC1IF( 0x00000002U );        ///< Capture/compare 1 interrupt flag.
+
+Tim& tim_( *reinterpret_cast<Tim*>(ADDRESS_TIM3) ); ///< TIM3 registers.
+
+/**
+ * @struct Statistics
+ * @brief Histograms of a scenario.
+ */
+struct Statistics
+{
+    uint32_t latency[NUMBER_OF_BINS]; ///< Entry latency as the counter at the entry minus the compare value.
+    uint32_t jitter[NUMBER_OF_BINS];  ///< Deviation of the interval between entries from the period.
+    uint32_t last;                    ///< CPU cycles of the last entry.
+    int32_t count;                    ///< Number of samples.
+};
+
+Statistics statistics_; ///< Statistics of the current scenario.
+
+/**
+ * @brief Puts a value to a histogram.
+ *
+ * @param histogram Histogram.
+ * @param value     Value in cycles, which is put to the last bin if it is longer than the histogram.
+ */
+void put(uint32_t* const histogram, uint32_t const value)
+{
+    uint32_t const bin( (value < static_cast<uint32_t>(NUMBER_OF_BINS)) ? value : static_cast<uint32_t>(NUMBER_OF_BINS - 1) );
+    histogram[bin]++;
+}
+
+/**
+ * @brief Handler of TIM3 compare interrupt, which samples its latency and restarts the compare.
+ */
+void handleTimer()
+{
+    uint32_t const counter( tim_.cnt );
+    uint32_t const time( pcb::CycleCounter::get() );
+    uint32_t const compare( tim_.ccr1 );
+    tim_.sr = ~TIM_SR_CC1IF;
+    tim_.ccr1 = (compare + PERIOD) & 0xFFFFU;
+    Statistics& statistics( statistics_ );
+    if( statistics.count < NUMBER_OF_SAMPLES )
+    {
+        put(statistics.latency, (counter - compare) & 0xFFFFU);
+        if( statistics.count > 0 )
+        {
+            uint32_t const interval( time - statistics.last );
+            put(statistics.jitter, (interval > PERIOD) ? (interval - PERIOD) : (PERIOD - interval));
+        }
+        statistics.last = time;
+        statistics.count++;
+    }
+}
+
+typedef pcb::StaticInterrupt<pcb::Nvic::IRQ_TIM3, &handleTimer> Interrupt; ///< TIM3 interrupt.
+
+/**
+ * @class Load
+ * @brief Thread loading the system until it is stopped.
+ */
+class Load : public lib::AbstractThreadTask<>
+{
+    typedef AbstractThreadTask<> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    Load()
+        : Parent()
+        , isStopped_( false ) {
+    }
+
+    /**
+     * @brief Stops the thread and waits for its end.
+     */
+    void stop()
+    {
+        isStopped_ = true;
+        static_cast<void>( join() );
+    }
+
+protected:
+
+    /**
+     * @brief Loads the system once.
+     */
+    virtual void load() = 0;
+
+private:
+
+    /**
+     * @copydoc eoos::api::Task::start()
+     */
+    virtual void start()
+    {
+        while( !isStopped_ )
+        {
+            load();
+        }
+    }
+
+    bool_t volatile isStopped_; ///< Stop request.
+
+};
+
+/**
+ * @class MutexLoad
+ * @brief Load of contention on a mutex.
+ */
+class MutexLoad : public Load
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param mutex Mutex shared by the loading threads.
+     */
+    MutexLoad(api::Mutex& mutex)
+        : Load()
+        , mutex_( mutex ) {
+    }
+
+private:
+
+    /**
+     * @brief Locks the mutex for 1000 cycles.
+     */
+    virtual void load()
+    {
+        lib::Guard<> const guard(mutex_);
+        uint32_t const start( pcb::CycleCounter::get() );
+        while( (pcb::CycleCounter::get() - start) < 1000U ){}
+    }
+
+    api::Mutex& mutex_; ///< Mutex shared by the loading threads.
+
+};
+
+/**
+ * @class CanLoad
+ * @brief Load of CAN transmission.
+ */
+class CanLoad : public Load
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param can CAN driver to transmit messages.
+     */
+    CanLoad(drv::Can& can)
+        : Load()
+        , can_( can ) {
+    }
+
+private:
+
+    /**
+     * @brief Transmits a message.
+     */
+    virtual void load()
+    {
+        drv::Can::Message message = {
+            .id  = {
+                .exid = 0b000000000000000011,
+                .stid = 0b0000000001
+            },
+            .rtr = false,
+            .ide = true,
+            .dlc = 8,
+            .data = {
+                .v64 = {
+                    0x0807060504030201
+                }
+            }
+        };
+        static_cast<void>( can_.transmit(message) );
+    }
+
+    drv::Can& can_; ///< CAN driver to transmit messages.
+
+};
+
+/**
+ * @class UsartLoad
+ * @brief Load of USART logging.
+ *
+ * Lines are logged to a USART other than the console one, so that they are not mixed with the test output.
+ */
+class UsartLoad : public Load
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param usart USART driver to log lines.
+     */
+    explicit UsartLoad(drv::Usart& usart)
+        : Load()
+        , usart_( usart ) {
+    }
+
+private:
+
+    /**
+     * @brief Logs a line.
+     */
+    virtual void load()
+    {
+        usart_ << "LATENCY: Logging load line\r\n";
+    }
+
+    drv::Usart& usart_; ///< USART driver to log lines.
+
+};
+
+/**
+ * @brief Returns a percentile of a histogram.
+ *
+ * @param histogram Histogram.
+ * @param permille  Percentile in tenths of percent.
+ * @return The value below which the given part of the samples is.
+ */
+int32_t getPercentile(uint32_t const* const histogram, int32_t const permille)
+{
+    uint32_t total( 0U );
+    for(int32_t i(0); i<NUMBER_OF_BINS; i++)
+    {
+        total += histogram[i];
+    }
+    uint32_t const rank( (total * static_cast<uint32_t>(permille) + 999U) / 1000U );
+    uint32_t count( 0U );
+    int32_t res( NUMBER_OF_BINS - 1 );
+    for(int32_t i(0); i<NUMBER_OF_BINS; i++)
+    {
+        count += histogram[i];
+        if( (count >= rank) && (count != 0U) )
+        {
+            res = i;
+            break;
+        }
+    }
+    return res;
+}
+
+/**
+ * @brief Returns the maximum value of a histogram.
+ *
+ * @param histogram Histogram.
+ * @return The last bin which is not empty.
+ */
+int32_t getMaximum(uint32_t const* const histogram)
+{
+    int32_t res( 0 );
+    for(int32_t i(0); i<NUMBER_OF_BINS; i++)
+    {
+        if( histogram[i] != 0U )
+        {
+            res = i;
+        }
+    }
+    return res;
+}
+
+/**
+ * @brief Prints percentiles and the maximum of a histogram.
+ *
+ * @param scenario  Name of the scenario.
+ * @param name      Name of the histogram.
+ * @param histogram Histogram.
+ */
+void printHistogram(char_t const* scenario, char_t const* name, uint32_t const* const histogram)
+{
+    lib::Stream::cout() << "LATENCY: " << scenario << " " << name
+        << " p50 " << getPercentile(histogram, 500)
+        << " p90 " << getPercentile(histogram, 900)
+        << " p99 " << getPercentile(histogram, 990)
+        << " p99.9 " << getPercentile(histogram, 999)
+        << " max " << getMaximum(histogram) << " cycles\r\n";
+}
+
+/**
+ * @brief Samples the timer interrupt in a scenario and prints its histograms.
+ *
+ * @param scenario Name of the scenario.
+ */
+void measure(char_t const* scenario)
+{
+    statistics_ = Statistics();
+    tim_.sr = 0U;
+    tim_.ccr1 = (tim_.cnt + PERIOD) & 0xFFFFU;
+    tim_.dier = TIM_DIER_CC1IE;
+    while( statistics_.count < NUMBER_OF_SAMPLES )
+    {
+        lib::Thread<>::sleep(10);
+    }
+    tim_.dier = 0U;
+    if( getPercentile(statistics_.latency, LATENCY_PERMILLE) >= NUMBER_OF_BINS - 1 )
+    {   // Failure as interrupts are delayed for a long time more often than the margin allows
+        TestRunner::fail();
+    }
+    printHistogram(scenario, "latency", statistics_.latency);
+    printHistogram(scenario, "jitter", statistics_.jitter);
+}
+
+/**
+ * @brief Starts TIM3 free running at CPU clock and enables its interrupt.
+ */
+void initializeTimer()
+{
+    uint32_t volatile& apb1enr( *reinterpret_cast<uint32_t volatile*>(ADDRESS_RCC_APB1ENR) );
+    apb1enr = apb1enr | APB1ENR_TIM3EN;
+    tim_.cr1 = 0U;
+    tim_.dier = 0U;
+    tim_.psc = 0U;
+    tim_.arr = 0xFFFFU;
+    tim_.ccmr1 = 0U;
+    tim_.cr1 = TIM_CR1_CEN;
+    if( !Interrupt::bind() )
+    {   // Failure
+        TestRunner::fail();
+    }
+    Interrupt::setPriority(configMAX_SYSCALL_INTERRUPT_PRIORITY);
+    Interrupt::enable();
+}
+
+} // namespace
+
+void testInterruptLatency()
+{
+    drv::Can::Config config = {
+        .number = drv::Can::NUMBER_CAN1,
+        .bitRate = drv::Can::BITRATE_1000,
+        .samplePoint = drv::Can::SAMPLEPOINT_CANOPEN,
+        .reg = {
+            .mcr = {
+                .txfp = 0,
+                .rflm = 0,
+                .dbf  = 0
+            },
+            .btr = {
+                .lbkm = 1, ///< Loop back mode not to need a bus
+                .silm = 1  ///< Silent mode not to disturb a bus
+            }
+        }
+    };
+    lib::UniquePointer<drv::Can> can( drv::Can::create(config) );
+    if( can.isNull() )
+    {   // Failure
+        TestRunner::fail();
+    }
+    drv::Usart::SerialLineConfig usartConfig = {
+        .number      = drv::Usart::NUMBER_USART2,
+        .mode        = drv::Usart::MODE_TX,
+        .baud        = drv::Usart::BAUD_115200,
+        .dataBits    = drv::Usart::DATABITS_8,
+        .stopBits    = drv::Usart::STOPBITS_1,
+        .parity      = drv::Usart::PARITY_NONE,
+        .flowControl = drv::Usart::FLOWCONTROL_NONE
+    };
+    lib::UniquePointer<drv::Usart> usart( drv::Usart::create(usartConfig) );
+    if( usart.isNull() )
+    {   // Failure
+        TestRunner::fail();
+    }
+    initializeTimer();
+    measure("idle");
+    {
+        lib::Mutex<> mutex;
+        MutexLoad first(mutex);
+        MutexLoad second(mutex);
+        first.execute();
+        second.execute();
+        measure("mutex");
+        first.stop();
+        second.stop();
+    }
+    {
+        CanLoad load(*can);
+        load.execute();
+        measure("can");
+        load.stop();
+    }
+    {
+        UsartLoad load(*usart);
+        load.execute();
+        measure("usart");
+        load.stop();
+    }
+    {
+        lib::Mutex<> mutex;
+        MutexLoad first(mutex);
+        MutexLoad second(mutex);
+        CanLoad transmission(*can);
+        UsartLoad logging(*usart);
+        first.execute();
+        second.execute();
+        transmission.execute();
+        logging.execute();
+        measure("all");
+        first.stop();
+        second.stop();
+        transmission.stop();
+        logging.stop();
+    }
+    Interrupt::disable();
+    // Success
+}
+
+namespace
+{
+
+/**
+ * @brief Registration of the suite.
+ */
+TestSuite const suite_("interrupt-latency", testInterruptLatency, TestSuite::TYPE_BENCHMARK, 60000);
+
+} // namespace
+
+} // namespace eoos
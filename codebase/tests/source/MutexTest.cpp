@@ -6,6 +6,7 @@
  * @brief Tests of thread yield.
  */
 #include "MutexTest.hpp"
+#include "TestRunner.hpp"
 #include "lib.AbstractThreadTask.hpp"
 #include "lib.Mutex.hpp"
 #include "lib.Guard.hpp"
@@ -66,7 +67,6 @@ private:
             resource_ = resource;
         }
         isCompleted_ = true;
-        while(true){}
     }
 
     /**
@@ -128,7 +128,6 @@ private:
             resource_ = resource;
         }
         isCompleted_ = true;
-        while(true){}
     }
     
     /**
@@ -164,10 +163,19 @@ void testMutex()
     }
     if(resource_ != 0)
     {   // Failure
-        while(true){}
+        TestRunner::fail();
     }
     // Success
-    while(true){}    
 }
 
+namespace
+{
+
+/**
+ * @brief Registration of the suite.
+ */
+TestSuite const suite_("mutex", testMutex, TestSuite::TYPE_TEST, 30000);
+
+} // namespace
+
 } // namespace eoos
@@ -0,0 +1,163 @@
+/**
+ * @file      PeriodicTaskTest.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of rate-monotonic periodic tasks.
+ */
+#include "PeriodicTaskTest.hpp"
+#include "TestRunner.hpp"
+#include "lib.Thread.hpp"
+#include "lib.Stream.hpp"
+#include "pcb.PeriodicScheduler.hpp"
+#include "pcb.Clock.hpp"
+
+namespace eoos
+{
+namespace
+{
+
+/**
+ * @brief Time of running the tasks in milliseconds.
+ */
+const int32_t TIME(1000);
+
+/**
+ * @class Load
+ * @brief Periodic task which loads CPU for a given time.
+ */
+class Load : public pcb::PeriodicTask
+{
+    typedef pcb::PeriodicTask Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param period   Period of the jobs in microseconds.
+     * @param deadline Deadline of the jobs relative to their release in microseconds.
+     * @param wcet     Worst-case execution time of a job in microseconds.
+     * @param load     Time of loading CPU by a job in microseconds.
+     */
+    Load(int32_t period, int32_t deadline, int32_t wcet, int32_t load)
+        : Parent(period, deadline, wcet)
+        , load_( pcb::Clock::toCycles( static_cast<uint64_t>(load) * 1000U ) ) {
+    }
+
+private:
+
+    /**
+     * @copydoc eoos::pcb::PeriodicTask::run()
+     */
+    virtual void run()
+    {
+        uint64_t const time( pcb::Clock::getCycles() + load_ );
+        while( pcb::Clock::getCycles() < time ){}
+    }
+
+    uint64_t load_; ///< Time of loading CPU by a job in cycles.
+
+};
+
+void printTask(char_t const* name, pcb::PeriodicTask const& task)
+{
+    lib::Stream::cout() << "PERIODIC: Task " << name << " jobs " << static_cast<int32_t>(task.getJobs())
+        << " misses " << static_cast<int32_t>(task.getMisses())
+        << " overruns " << static_cast<int32_t>(task.getOverruns())
+        << " response " << static_cast<int32_t>( pcb::Clock::toNanoseconds(task.getResponse()) / 1000U ) << " us\r\n";
+    lib::Stream::cout() << "PERIODIC: Histogram";
+    for(int32_t i(0); i<pcb::PeriodicTask::NUMBER_OF_BINS; i++)
+    {
+        lib::Stream::cout() << " " << static_cast<int32_t>(task.getHistogram(i));
+    }
+    lib::Stream::cout() << "\r\n";
+}
+
+void testPeriodicTaskUnschedulable()
+{
+    Load fast(10000, 10000, 6000, 0);
+    Load slow(20000, 20000, 9000, 0);
+    pcb::PeriodicScheduler scheduler;
+    if( !scheduler.add(fast) || !scheduler.add(slow) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    // Utilization is 105%
+    if( scheduler.isSchedulable() )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( scheduler.start() )
+    {   // Failure
+        TestRunner::fail();
+    }
+}
+
+void testPeriodicTaskSchedulable()
+{
+    Load fast(10000, 10000, 2000, 1000);
+    Load middle(20000, 15000, 4000, 3000);
+    Load slow(50000, 50000, 12000, 10000);
+    pcb::PeriodicScheduler scheduler;
+    if( !scheduler.add(slow) || !scheduler.add(fast) || !scheduler.add(middle) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( scheduler.add(fast) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( !scheduler.start() )
+    {   // Failure
+        TestRunner::fail();
+    }
+    lib::Thread<>::sleep(TIME);
+    scheduler.stop();
+    if( (fast.getMisses() != 0U) || (middle.getMisses() != 0U) || (slow.getMisses() != 0U) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( (fast.getJobs() < 99U) || (middle.getJobs() < 49U) || (slow.getJobs() < 19U) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    // Jobs of the highest priority task are not preempted by the other tasks
+    if( fast.getOverruns() != 0U )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( fast.getPriority() <= slow.getPriority() )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( !scheduler.isSchedulable() )
+    {   // Failure
+        TestRunner::fail();
+    }
+    lib::Stream::cout() << "PERIODIC: Utilization " << scheduler.getUtilization() << " %\r\n";
+    printTask("10ms", fast);
+    printTask("20ms", middle);
+    printTask("50ms", slow);
+}
+
+} // namespace
+
+void testPeriodicTask()
+{
+    testPeriodicTaskUnschedulable();
+    testPeriodicTaskSchedulable();
+    // Success
+}
+
+namespace
+{
+
+/**
+ * @brief Registration of the suite.
+ */
+TestSuite const suite_("periodic-task", testPeriodicTask, TestSuite::TYPE_TEST, 30000);
+
+} // namespace
+
+} // namespace eoos
@@ -6,16 +6,10 @@
  * @brief Program of tests.
  */
 #include "Program.hpp"
-#include "ContexSwitchTest.hpp"
-#include "ThreadYieldTest.hpp"
-#include "MutexTest.hpp"
-#include "SemaphoreTest.hpp"
-#include "DriverUsartTest.hpp"
-#include "DriverNullTest.hpp"
-#include "DriverGpioTest.hpp"
-#include "DriverCanTest.hpp"
+#include "TestRunner.hpp"
 #include "lib.Stream.hpp"
 #include "sys.System.hpp"
+#include "pcb.SystemConfig.hpp"
 
 namespace eoos
 {
@@ -40,6 +34,13 @@ static void printConfiguration()
     #else        
         lib::Stream::cout() << "LANGUAGE: unknown\r\n";
     #endif
+
+    // Output of C++ run-time features.
+    #if defined (__EXCEPTIONS)
+        lib::Stream::cout() << "RUNTIME: C++ exceptions enabled\r\n";
+    #else
+        lib::Stream::cout() << "RUNTIME: C++ exceptions disabled\r\n";
+    #endif
     
     // Output of Data Model of a hardware system.  
     #if defined (EOOS_GLOBAL_TYPE_STDLIB)
@@ -101,6 +102,7 @@ static void printConfiguration()
 
     // EOOS state:
     lib::Stream::cout() << "EOOS: Size of system " << static_cast<int32_t>(sizeof(sys::System)) << " Bytes\r\n";
+    lib::Stream::cout() << "EOOS: Size of pools " << static_cast<int32_t>(pcb::SystemConfig::MEMORY) << " Bytes of " << static_cast<int32_t>(pcb::SystemConfig::MEMORY + pcb::SystemConfig::MEMORY_LEFT) << " Bytes\r\n";
 }
 
 /**
@@ -109,32 +111,8 @@ static void printConfiguration()
 int32_t Program::start(int32_t argc, char_t* argv[])
 {
     printConfiguration();
-        
-    // Comment to lock or uncomment to execute
-    // testContexSwitch();
-    
-    // Comment to lock or uncomment to execute
-    // testThreadYield();
-
-    // Comment to lock or uncomment to execute    
-    // testMutex();
-
-    // Comment to lock or uncomment to execute    
-    // testSemaphore();
-
-    // Comment to lock or uncomment to execute    
-    // testDriverUsart();
-
-    // Comment to lock or uncomment to execute    
-    // testDriverNull(); 
-
-    // Comment to lock or uncomment to execute    
-    testDriverCan();
-
-    // Comment to lock or uncomment to execute    
-    // testDriverGpio();
-    
-    return 0;
+    TestRunner runner;
+    return runner.execute(argc, argv);
 }
 
 } // namespace eoos
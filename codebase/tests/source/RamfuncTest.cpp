@@ -0,0 +1,120 @@
+/**
+ * @file      RamfuncTest.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of functions executed from SRAM.
+ */
+#include "RamfuncTest.hpp"
+#include "TestRunner.hpp"
+#include "lib.Stream.hpp"
+#include "pcb.Ramfunc.hpp"
+#include "pcb.CycleCounter.hpp"
+
+namespace eoos
+{
+namespace
+{
+
+const int32_t NUMBER_OF_CALLS(100);
+const int32_t NUMBER_OF_WORDS(256);
+
+/**
+ * @brief Address range of SRAM.
+ */
+const uint32_t ADDRESS_SRAM( 0x20000000U );
+const uint32_t SIZE_SRAM( 0x00010000U );
+
+/**
+ * @brief Benchmarked function type.
+ */
+typedef uint32_t (*Function)(uint32_t const* data, int32_t length);
+
+uint32_t words[NUMBER_OF_WORDS];
+
+/**
+ * @brief Calculates CRC-32 of words to load CPU with branches and memory accesses.
+ */
+uint32_t calculateInFlash(uint32_t const* data, int32_t length)
+{
+    uint32_t crc( 0xFFFFFFFFU );
+    for(int32_t i(0); i<length; i++)
+    {
+        crc ^= data[i];
+        for(int32_t j(0); j<32; j++)
+        {
+            crc = ((crc & 1U) != 0U) ? ((crc >> 1) ^ 0xEDB88320U) : (crc >> 1);
+        }
+    }
+    return ~crc;
+}
+
+/**
+ * @brief Calculates CRC-32 of words from SRAM.
+ */
+EOOS_PCB_RAMFUNC uint32_t calculateInSram(uint32_t const* data, int32_t length);
+
+uint32_t calculateInSram(uint32_t const* data, int32_t length)
+{
+    uint32_t crc( 0xFFFFFFFFU );
+    for(int32_t i(0); i<length; i++)
+    {
+        crc ^= data[i];
+        for(int32_t j(0); j<32; j++)
+        {
+            crc = ((crc & 1U) != 0U) ? ((crc >> 1) ^ 0xEDB88320U) : (crc >> 1);
+        }
+    }
+    return ~crc;
+}
+
+uint32_t benchmarkFunction(Function volatile const function, uint32_t* const result)
+{
+    uint32_t min( 0xFFFFFFFFU );
+    for(int32_t i(0); i<NUMBER_OF_CALLS; i++)
+    {
+        uint32_t const start( pcb::CycleCounter::get() );
+        *result = function(words, NUMBER_OF_WORDS);
+        uint32_t const cycles( pcb::CycleCounter::get() - start );
+        min = (cycles < min) ? cycles : min;
+    }
+    return min;
+}
+
+} // namespace
+
+void testRamfunc()
+{
+    uint32_t const address( reinterpret_cast<uint32_t>(&calculateInSram) );
+    if( (address < ADDRESS_SRAM) || (address >= ADDRESS_SRAM + SIZE_SRAM) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    for(int32_t i(0); i<NUMBER_OF_WORDS; i++)
+    {
+        words[i] = static_cast<uint32_t>(i) * 0x9E3779B9U;
+    }
+    uint32_t flashResult( 0U );
+    uint32_t sramResult( 0U );
+    uint32_t const flashCycles( benchmarkFunction(&calculateInFlash, &flashResult) );
+    uint32_t const sramCycles( benchmarkFunction(&calculateInSram, &sramResult) );
+    if( flashResult != sramResult )
+    {   // Failure
+        TestRunner::fail();
+    }
+    lib::Stream::cout() << "RAMFUNC: Function in FLASH " << static_cast<int32_t>(flashCycles) << " cycles\r\n";
+    lib::Stream::cout() << "RAMFUNC: Function in SRAM " << static_cast<int32_t>(sramCycles) << " cycles\r\n";
+    // Success
+}
+
+namespace
+{
+
+/**
+ * @brief Registration of the suite.
+ */
+TestSuite const suite_("ramfunc", testRamfunc, TestSuite::TYPE_BENCHMARK, 10000);
+
+} // namespace
+
+} // namespace eoos
@@ -0,0 +1,135 @@
+/**
+ * @file      RegisterTest.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of typed register access.
+ */
+#include "RegisterTest.hpp"
+#include "TestRunner.hpp"
+#include "lib.Stream.hpp"
+#include "pcb.Register.hpp"
+#include "pcb.CycleCounter.hpp"
+
+namespace eoos
+{
+namespace
+{
+
+const int32_t NUMBER_OF_WRITES(1000);
+
+/**
+ * @brief Simulated register file.
+ */
+uint32_t volatile file[2];
+
+/**
+ * @class Simulated
+ * @brief Peripheral of the simulated register file.
+ */
+class Simulated
+{
+
+public:
+
+    static uint32_t getAddress()
+    {
+        return reinterpret_cast<uint32_t>( &file[0] );
+    }
+
+};
+
+typedef pcb::Register<Simulated, 0x0U> Control;
+typedef pcb::Register<Simulated, 0x4U, pcb::REGISTER_ACCESS_RO> Status;
+
+typedef pcb::RegisterField<Control, 0U> ControlEnable;
+typedef pcb::RegisterField<Control, 4U, 3U> ControlMode;
+typedef pcb::RegisterField<Control, 12U, 2U> ControlPriority;
+typedef pcb::RegisterField<Status, 8U, 8U> StatusCount;
+
+/**
+ * @struct Bits
+ * @brief The control register as bit-fields.
+ */
+struct Bits
+{
+    uint32_t enable   : 1;
+    uint32_t          : 3;
+    uint32_t mode     : 3;
+    uint32_t          : 5;
+    uint32_t priority : 2;
+    uint32_t          : 18;
+};
+
+void testRegisterAccess()
+{
+    file[0] = 0xFFFF0000U;
+    Control::write( ControlEnable::set() | ControlMode::value(5U) );
+    if( file[0] != 0x00000051U )
+    {   // Failure
+        TestRunner::fail();
+    }
+    file[0] = 0xFFFF0000U;
+    Control::modify( ControlEnable::set() | ControlMode::value(5U) | ControlPriority::value(2U) );
+    if( file[0] != 0xFFFF2051U )
+    {   // Failure
+        TestRunner::fail();
+    }
+    Control::modify( ControlMode::value(9U) | ControlEnable::clear() );
+    if( file[0] != 0xFFFF2010U )
+    {   // Failure
+        TestRunner::fail();
+    }
+    ControlPriority::modify(1U);
+    if( (ControlPriority::read() != 1U) || (ControlMode::read() != 1U) || (file[0] != 0xFFFF1010U) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    file[1] = 0x00012A00U;
+    if( (StatusCount::read() != 0x2AU) || !StatusCount::isSet( Status::read() ) )
+    {   // Failure
+        TestRunner::fail();
+    }
+}
+
+void benchmarkRegister()
+{
+    Bits volatile& bits( *reinterpret_cast<Bits volatile*>( &file[0] ) );
+    uint32_t start( pcb::CycleCounter::get() );
+    for(int32_t i(0); i<NUMBER_OF_WRITES; i++)
+    {
+        bits.enable = 1U;
+        bits.mode = static_cast<uint32_t>(i) & 0x7U;
+        bits.priority = 3U;
+    }
+    int32_t const bitfield( static_cast<int32_t>( (pcb::CycleCounter::get() - start) / NUMBER_OF_WRITES ) );
+    start = pcb::CycleCounter::get();
+    for(int32_t i(0); i<NUMBER_OF_WRITES; i++)
+    {
+        Control::modify( ControlEnable::set() | ControlMode::value(static_cast<uint32_t>(i)) | ControlPriority::value(3U) );
+    }
+    int32_t const typed( static_cast<int32_t>( (pcb::CycleCounter::get() - start) / NUMBER_OF_WRITES ) );
+    lib::Stream::cout() << "REGISTER: Three bit-fields modified " << bitfield << " cycles\r\n";
+    lib::Stream::cout() << "REGISTER: Three typed fields modified " << typed << " cycles\r\n";
+}
+
+} // namespace
+
+void testRegister()
+{
+    testRegisterAccess();
+    benchmarkRegister();
+    // Success
+}
+
+namespace
+{
+
+/**
+ * @brief Registration of the suite.
+ */
+TestSuite const suite_("register", testRegister, TestSuite::TYPE_TEST, 10000);
+
+} // namespace
+
+} // namespace eoos
@@ -6,9 +6,17 @@
  * @brief Tests of thread yield.
  */
 #include "SemaphoreTest.hpp"
+#include "TestRunner.hpp"
 #include "lib.AbstractThreadTask.hpp"
 #include "lib.Semaphore.hpp"
+#include "lib.Thread.hpp"
 #include "sys.Semaphore.hpp"
+#include "lib.Stream.hpp"
+#include "pcb.Notifier.hpp"
+#include "pcb.StaticInterrupt.hpp"
+#include "pcb.CycleCounter.hpp"
+#include "FreeRTOS.h"
+#include "semphr.h"
 
 namespace eoos
 {
@@ -16,6 +24,26 @@ namespace
 {
 
 const int32_t MAX_WAIT_COUNT(0x800000);
+
+/**
+ * @brief Number of wakes of a thread by an interrupt.
+ */
+const int32_t NUMBER_OF_WAKES(1000);
+
+/**
+ * @brief Interrupt request which is not used by the board and requested by software.
+ */
+const int32_t IRQ( pcb::Nvic::IRQ_TIM7 );
+
+/**
+ * @brief Notifier to be notified by the interrupt.
+ */
+pcb::Notifier* volatile notifier_( NULLPTR );
+
+/**
+ * @brief Semaphore to be given by the interrupt.
+ */
+SemaphoreHandle_t volatile semaphore_( NULLPTR );
     
 /**
  * @class Task
@@ -60,15 +88,14 @@ private:
         res = isAcquired_ = semAcquire_.acquire();
         if( res == false )
         {   // Failure
-            while(true){}        
+            TestRunner::fail();
         }
         res = semRelease_.release();
         if( res == false )
         {   // Failure
-            while(true){}        
+            TestRunner::fail();
         }
         // Success
-        while(true){}
     }
     
     bool_t isAcquired_;          ///< Acquirement flag.
@@ -83,12 +110,12 @@ void testSemaphoreAsMutex()
     res = sem.acquire();
     if( res == false )
     {   // Failure
-        while(true){}        
+        TestRunner::fail();
     }
     res = sem.release();
     if( res == false )
     {   // Failure
-        while(true){}        
+        TestRunner::fail();
     }
 }
 
@@ -102,22 +129,22 @@ void testSemaphoreAsCounting()
     res = semAcquire.release();
     if( res == false )
     {   // Failure
-        while(true){}        
+        TestRunner::fail();
     }
     res = semAcquire.release();
     if( res == false )
     {   // Failure
-        while(true){}        
+        TestRunner::fail();
     }
     res = semRelease.acquire();
     if( res == false )
     {   // Failure
-        while(true){}        
+        TestRunner::fail();
     }
     bool_t wasAcquired( thread.wasAcquired() );
     if( !wasAcquired )
     {   // Failure
-        while(true){}
+        TestRunner::fail();
     }
 }
 
@@ -131,25 +158,340 @@ void testSemaphoreAsBinary()
     res = semAcquire.release();
     if( res == false )
     {   // Failure
-        while(true){}        
+        TestRunner::fail();
     }
     res = semAcquire.release();
     if( res == true )
     {   // Failure
-        while(true){}        
+        TestRunner::fail();
     }
     res = semRelease.acquire();
     if( res == false )
     {   // Failure
-        while(true){}        
+        TestRunner::fail();
     }
     bool_t wasAcquired( thread.wasAcquired() );
     if( !wasAcquired )
     {   // Failure
-        while(true){}
+        TestRunner::fail();
     }
 }
 
+/**
+ * @brief Signals the waiting thread from the interrupt.
+ */
+void handleSignal()
+{
+    pcb::Notifier* const notifier( notifier_ );
+    SemaphoreHandle_t const semaphore( semaphore_ );
+    if( notifier != NULLPTR )
+    {
+        static_cast<void>( notifier->notifyFromInterrupt() );
+    }
+    else if( semaphore != NULLPTR )
+    {
+        BaseType_t isWoken( pdFALSE );
+        static_cast<void>( xSemaphoreGiveFromISR(semaphore, &isWoken) );
+        portYIELD_FROM_ISR(isWoken);
+    }
+}
+
+typedef pcb::StaticInterrupt<IRQ, &handleSignal> Interrupt; ///< The interrupt signaling threads.
+
+/**
+ * @class Waiter
+ * @brief Thread waiting for signals of the interrupt.
+ */
+class Waiter : public lib::AbstractThreadTask<>
+{
+    typedef AbstractThreadTask<> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    Waiter() : Parent(),
+        wake_ (0U),
+        wakes_ (0),
+        isWaiting_ (false){
+    }
+
+    /**
+     * @brief Returns CPU cycles of the last wake.
+     *
+     * @return The cycles.
+     */
+    uint32_t getWake() const
+    {
+        return wake_;
+    }
+
+    /**
+     * @brief Returns the number of wakes.
+     *
+     * @return The number.
+     */
+    int32_t getWakes() const
+    {
+        return wakes_;
+    }
+
+    /**
+     * @brief Tests if the thread waits for signals.
+     *
+     * @return True if the thread is ready to be signaled.
+     */
+    bool_t isWaiting() const
+    {
+        return isWaiting_;
+    }
+
+protected:
+
+    /**
+     * @brief Prepares the thread to wait.
+     *
+     * @return True if the thread has been prepared.
+     */
+    virtual bool_t prepare() = 0;
+
+    /**
+     * @brief Waits for a signal.
+     *
+     * @return True if the signal has been taken.
+     */
+    virtual bool_t wait() = 0;
+
+    /**
+     * @brief Finishes waiting before the thread ends.
+     */
+    virtual void finish() = 0;
+
+private:
+
+    /**
+     * @copydoc eoos::api::Task::start()
+     */
+    virtual void start()
+    {
+        if( !prepare() )
+        {   // Failure
+            TestRunner::fail();
+        }
+        isWaiting_ = true;
+        for(int32_t i(0); i<NUMBER_OF_WAKES; i++)
+        {
+            if( !wait() )
+            {   // Failure
+                TestRunner::fail();
+            }
+            wake_ = pcb::CycleCounter::get();
+            wakes_ = wakes_ + 1;
+        }
+        finish();
+    }
+
+    uint32_t volatile wake_;    ///< CPU cycles of the last wake.
+    int32_t volatile wakes_;    ///< Number of wakes.
+    bool_t volatile isWaiting_; ///< The thread is ready to be signaled.
+};
+
+/**
+ * @class SemaphoreWaiter
+ * @brief Thread waiting for signals of semaphore.
+ */
+class SemaphoreWaiter : public Waiter
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param semaphore Semaphore to take.
+     */
+    explicit SemaphoreWaiter(SemaphoreHandle_t semaphore) : Waiter(),
+        semaphore_ (semaphore){
+    }
+
+protected:
+
+    /**
+     * @copydoc eoos::Waiter::prepare()
+     */
+    virtual bool_t prepare()
+    {
+        return true;
+    }
+
+    /**
+     * @copydoc eoos::Waiter::wait()
+     */
+    virtual bool_t wait()
+    {
+        return xSemaphoreTake(semaphore_, portMAX_DELAY) == pdTRUE;
+    }
+
+    /**
+     * @copydoc eoos::Waiter::finish()
+     */
+    virtual void finish()
+    {
+    }
+
+private:
+
+    SemaphoreHandle_t semaphore_; ///< Semaphore to take.
+};
+
+/**
+ * @class NotifierWaiter
+ * @brief Thread waiting for signals of notifier.
+ */
+class NotifierWaiter : public Waiter
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param notifier Notifier to be bound to the thread and to wait on.
+     */
+    explicit NotifierWaiter(pcb::Notifier& notifier) : Waiter(),
+        notifier_ (notifier){
+    }
+
+protected:
+
+    /**
+     * @copydoc eoos::Waiter::prepare()
+     */
+    virtual bool_t prepare()
+    {
+        return notifier_.bind();
+    }
+
+    /**
+     * @copydoc eoos::Waiter::wait()
+     */
+    virtual bool_t wait()
+    {
+        return notifier_.wait();
+    }
+
+    /**
+     * @copydoc eoos::Waiter::finish()
+     */
+    virtual void finish()
+    {
+        notifier_.unbind();
+    }
+
+private:
+
+    pcb::Notifier& notifier_; ///< Notifier to wait on.
+};
+
+void testNotifier()
+{
+    pcb::Notifier notifier( pcb::Notifier::TYPE_BINARY );
+    if( notifier.notify() )
+    {   // Failure as the notifier is not bound yet
+        TestRunner::fail();
+    }
+    if( !notifier.bind() )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( notifier.wait(10) )
+    {   // Failure as no notification was sent
+        TestRunner::fail();
+    }
+    if( !notifier.notify() || !notifier.notify() )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( !notifier.wait(0) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( notifier.wait(0) )
+    {   // Failure as the binary notifier consumes all notifications
+        TestRunner::fail();
+    }
+}
+
+int32_t measureWake(Waiter& waiter)
+{
+    // The waiter preempts this thread on each wake, so it waits again when this thread continues
+    if( !waiter.setPriority(api::Thread::PRIORITY_MAX) || !waiter.execute() )
+    {   // Failure
+        TestRunner::fail();
+    }
+    while( !waiter.isWaiting() )
+    {
+        lib::Thread<>::yield();
+    }
+    uint32_t cycles( 0U );
+    for(int32_t i(0); i<NUMBER_OF_WAKES; i++)
+    {
+        uint32_t const start( pcb::CycleCounter::get() );
+        Interrupt::trigger();
+        if( waiter.getWakes() != i + 1 )
+        {   // Failure
+            TestRunner::fail();
+        }
+        cycles += waiter.getWake() - start;
+    }
+    static_cast<void>( waiter.join() );
+    return static_cast<int32_t>(cycles / NUMBER_OF_WAKES);
+}
+
+int32_t benchmarkSemaphoreAsBinary()
+{
+    StaticSemaphore_t buffer;
+    SemaphoreHandle_t const semaphore( xSemaphoreCreateBinaryStatic(&buffer) );
+    if( semaphore == NULLPTR )
+    {   // Failure
+        TestRunner::fail();
+    }
+    SemaphoreWaiter thread(semaphore);
+    semaphore_ = semaphore;
+    int32_t const cycles( measureWake(thread) );
+    semaphore_ = NULLPTR;
+    vSemaphoreDelete(semaphore);
+    return cycles;
+}
+
+int32_t benchmarkNotifier()
+{
+    pcb::Notifier notifier( pcb::Notifier::TYPE_BINARY );
+    NotifierWaiter thread(notifier);
+    notifier_ = &notifier;
+    int32_t const cycles( measureWake(thread) );
+    notifier_ = NULLPTR;
+    return cycles;
+}
+
+void benchmarkSignal()
+{
+    if( !Interrupt::bind() )
+    {   // Failure
+        TestRunner::fail();
+    }
+    Interrupt::setPriority(configMAX_SYSCALL_INTERRUPT_PRIORITY);
+    Interrupt::enable();
+    int32_t const semaphore( benchmarkSemaphoreAsBinary() );
+    int32_t const notifier( benchmarkNotifier() );
+    Interrupt::disable();
+    lib::Stream::cout() << "SEMAPHORE: Interrupt to thread wake of binary semaphore " << semaphore << " cycles\r\n";
+    lib::Stream::cout() << "SEMAPHORE: Interrupt to thread wake of notifier " << notifier << " cycles\r\n";
+    lib::Stream::cout() << "SEMAPHORE: Memory of binary semaphore " << static_cast<int32_t>(sizeof(sys::Semaphore)) << " Bytes\r\n";
+    lib::Stream::cout() << "SEMAPHORE: Memory of notifier " << static_cast<int32_t>(sizeof(pcb::Notifier)) << " Bytes\r\n";
+}
+
 } // namespace
 
 void testSemaphore()
@@ -157,8 +499,19 @@ void testSemaphore()
     testSemaphoreAsMutex();
     testSemaphoreAsCounting();
     testSemaphoreAsBinary();
+    testNotifier();
+    benchmarkSignal();
     // Success
-    while(true){}
 }
 
+namespace
+{
+
+/**
+ * @brief Registration of the suite.
+ */
+TestSuite const suite_("semaphore", testSemaphore, TestSuite::TYPE_TEST, 30000);
+
+} // namespace
+
 } // namespace eoos
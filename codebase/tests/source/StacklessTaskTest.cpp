@@ -0,0 +1,384 @@
+/**
+ * @file      StacklessTaskTest.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of stackless tasks.
+ */
+#include "StacklessTaskTest.hpp"
+#include "TestRunner.hpp"
+#include "lib.AbstractThreadTask.hpp"
+#include "lib.Thread.hpp"
+#include "lib.Stream.hpp"
+#include "pcb.StacklessScheduler.hpp"
+#include "pcb.CycleCounter.hpp"
+
+namespace eoos
+{
+namespace
+{
+
+const int32_t NUMBER_OF_TASKS(16);
+const int32_t NUMBER_OF_PERIODS(5);
+const int32_t NUMBER_OF_SWITCHES(1000);
+
+/**
+ * @class PeriodicTask
+ * @brief Stackless task counting its periods.
+ */
+class PeriodicTask : public pcb::StacklessTask
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    PeriodicTask() : pcb::StacklessTask(),
+        period_ (0),
+        count_ (0){
+    }
+
+    /**
+     * @brief Sets period of the task.
+     *
+     * @param period Period in milliseconds.
+     */
+    void setPeriod(int32_t period)
+    {
+        period_ = period;
+    }
+
+    /**
+     * @brief Returns number of periods passed.
+     *
+     * @return Number of periods.
+     */
+    int32_t getCount() const
+    {
+        return count_;
+    }
+
+protected:
+
+    /**
+     * @copydoc eoos::pcb::StacklessTask::run()
+     */
+    virtual Status run()
+    {
+        EOOS_PCB_STACKLESS_BEGIN();
+        for(count_ = 0; count_ < NUMBER_OF_PERIODS; count_++)
+        {
+            EOOS_PCB_STACKLESS_SLEEP(period_);
+        }
+        EOOS_PCB_STACKLESS_END();
+    }
+
+private:
+
+    int32_t period_; ///< Period in milliseconds.
+    int32_t count_;  ///< Number of periods passed.
+};
+
+/**
+ * @class EventTask
+ * @brief Stackless task waiting for an event.
+ */
+class EventTask : public pcb::StacklessTask
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param bits Bits to wait for.
+     */
+    explicit EventTask(uint32_t bits) : pcb::StacklessTask(),
+        waitBits_ (bits),
+        receivedBits_ (0U){
+    }
+
+    /**
+     * @brief Returns received bits.
+     *
+     * @return The bits.
+     */
+    uint32_t getReceivedBits() const
+    {
+        return receivedBits_;
+    }
+
+protected:
+
+    /**
+     * @copydoc eoos::pcb::StacklessTask::run()
+     */
+    virtual Status run()
+    {
+        EOOS_PCB_STACKLESS_BEGIN();
+        EOOS_PCB_STACKLESS_WAIT(waitBits_, 1000);
+        receivedBits_ = getBits();
+        EOOS_PCB_STACKLESS_END();
+    }
+
+private:
+
+    uint32_t waitBits_;     ///< Bits to wait for.
+    uint32_t receivedBits_; ///< Received bits.
+};
+
+/**
+ * @class YieldTask
+ * @brief Stackless task yielding control.
+ */
+class YieldTask : public pcb::StacklessTask
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    YieldTask() : pcb::StacklessTask(),
+        count_ (0){
+    }
+
+protected:
+
+    /**
+     * @copydoc eoos::pcb::StacklessTask::run()
+     */
+    virtual Status run()
+    {
+        EOOS_PCB_STACKLESS_BEGIN();
+        for(count_ = 0; count_ < NUMBER_OF_SWITCHES; count_++)
+        {
+            EOOS_PCB_STACKLESS_YIELD();
+        }
+        EOOS_PCB_STACKLESS_END();
+    }
+
+private:
+
+    int32_t count_; ///< Number of yields.
+};
+
+/**
+ * @class YieldThread
+ * @brief Thread yielding control.
+ *
+ * The thread gets ready and waits for the start flag, so that
+ * only its yield loop is measured.
+ */
+class YieldThread : public lib::AbstractThreadTask<>
+{
+    typedef AbstractThreadTask<> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param isStarted Flag to start the yield loop.
+     */
+    explicit YieldThread(bool_t volatile& isStarted) : Parent(),
+        isStarted_ (isStarted),
+        isReady_ (false),
+        end_ (0U){
+    }
+
+    /**
+     * @brief Tests if the thread waits for the start flag.
+     *
+     * @return true if the thread is ready.
+     */
+    bool_t isReady() const
+    {
+        return isReady_;
+    }
+
+    /**
+     * @brief Returns cycle counter value at the end of the yield loop.
+     *
+     * @return The counter value.
+     */
+    uint32_t getEnd() const
+    {
+        return end_;
+    }
+
+private:
+
+    /**
+     * @copydoc eoos::api::Task::start()
+     */
+    virtual void start()
+    {
+        isReady_ = true;
+        while( !isStarted_ )
+        {
+            lib::Thread<>::yield();
+        }
+        for(int32_t i(0); i<NUMBER_OF_SWITCHES; i++)
+        {
+            lib::Thread<>::yield();
+        }
+        end_ = pcb::CycleCounter::get();
+    }
+
+    bool_t volatile& isStarted_; ///< Flag to start the yield loop.
+    bool_t volatile isReady_;    ///< The thread waits for the start flag.
+    uint32_t volatile end_;      ///< Cycle counter value at the end of the yield loop.
+};
+
+/**
+ * @class Producer
+ * @brief Thread raising an event of a scheduler.
+ */
+class Producer : public lib::AbstractThreadTask<>
+{
+    typedef AbstractThreadTask<> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param flag Event to raise.
+     */
+    explicit Producer(pcb::EventFlag& flag) : Parent(),
+        flag_ (flag){
+    }
+
+private:
+
+    /**
+     * @copydoc eoos::api::Task::start()
+     */
+    virtual void start()
+    {
+        lib::Thread<>::sleep(20);
+        if( !flag_.raise() )
+        {   // Failure
+            TestRunner::fail();
+        }
+    }
+
+    pcb::EventFlag& flag_; ///< Event to raise.
+};
+
+/**
+ * @brief Tasks of the periodic test.
+ *
+ * @note The tasks are static as they do not fit a thread stack.
+ */
+PeriodicTask periodicTasks_[NUMBER_OF_TASKS];
+
+void testStacklessTaskPeriodic()
+{
+    pcb::StacklessScheduler scheduler;
+    for(int32_t i(0); i<NUMBER_OF_TASKS; i++)
+    {
+        periodicTasks_[i].setPeriod(i + 1);
+        if( !scheduler.add(periodicTasks_[i]) )
+        {   // Failure
+            TestRunner::fail();
+        }
+    }
+    if( !scheduler.run() )
+    {   // Failure
+        TestRunner::fail();
+    }
+    for(int32_t i(0); i<NUMBER_OF_TASKS; i++)
+    {
+        if( periodicTasks_[i].getCount() != NUMBER_OF_PERIODS )
+        {   // Failure
+            TestRunner::fail();
+        }
+    }
+}
+
+void testStacklessTaskEvent()
+{
+    pcb::StacklessScheduler scheduler;
+    pcb::EventFlag flag(scheduler.getEventGroup(), 3);
+    EventTask task(flag.getMask());
+    Producer producer(flag);
+    if( !scheduler.add(task) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    producer.execute();
+    if( !scheduler.run() )
+    {   // Failure
+        TestRunner::fail();
+    }
+    producer.join();
+    if( task.getReceivedBits() != flag.getMask() )
+    {   // Failure
+        TestRunner::fail();
+    }
+}
+
+void benchmarkStacklessTask()
+{
+    int32_t taskCycles( 0 );
+    {
+        pcb::StacklessScheduler scheduler;
+        YieldTask task1;
+        YieldTask task2;
+        static_cast<void>( scheduler.add(task1) );
+        static_cast<void>( scheduler.add(task2) );
+        uint32_t const start( pcb::CycleCounter::get() );
+        static_cast<void>( scheduler.run() );
+        taskCycles = static_cast<int32_t>( (pcb::CycleCounter::get() - start) / (NUMBER_OF_SWITCHES * 2) );
+    }
+    int32_t threadCycles( 0 );
+    {
+        bool_t volatile isStarted( false );
+        YieldThread thread1(isStarted);
+        YieldThread thread2(isStarted);
+        thread1.execute();
+        thread2.execute();
+        while( !thread1.isReady() || !thread2.isReady() )
+        {
+            lib::Thread<>::sleep(1);
+        }
+        uint32_t const start( pcb::CycleCounter::get() );
+        isStarted = true;
+        thread1.join();
+        thread2.join();
+        // The thread which ends last makes the last switch
+        uint32_t const end1( thread1.getEnd() - start );
+        uint32_t const end2( thread2.getEnd() - start );
+        uint32_t const end( (end1 > end2) ? end1 : end2 );
+        threadCycles = static_cast<int32_t>( end / (NUMBER_OF_SWITCHES * 2) );
+    }
+    lib::Stream::cout() << "STACKLESS: Switch of task " << taskCycles << " cycles\r\n";
+    lib::Stream::cout() << "STACKLESS: Switch of thread " << threadCycles << " cycles\r\n";
+    lib::Stream::cout() << "STACKLESS: Memory of task " << static_cast<int32_t>(sizeof(YieldTask)) << " Bytes\r\n";
+    lib::Stream::cout() << "STACKLESS: Memory of thread " << static_cast<int32_t>(sizeof(YieldThread) + EOOS_GLOBAL_SYS_FREERTOS_TASK_STACK_SIZE) << " Bytes\r\n";
+}
+
+} // namespace
+
+void testStacklessTask()
+{
+    testStacklessTaskPeriodic();
+    testStacklessTaskEvent();
+    benchmarkStacklessTask();
+    // Success
+}
+
+namespace
+{
+
+/**
+ * @brief Registration of the suite.
+ */
+TestSuite const suite_("stackless-task", testStacklessTask, TestSuite::TYPE_TEST, 30000);
+
+} // namespace
+
+} // namespace eoos
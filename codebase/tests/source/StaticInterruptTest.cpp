@@ -0,0 +1,143 @@
+/**
+ * @file      StaticInterruptTest.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of interrupts with handlers bound at compile time.
+ */
+#include "StaticInterruptTest.hpp"
+#include "TestRunner.hpp"
+#include "lib.Stream.hpp"
+#include "pcb.StaticInterrupt.hpp"
+#include "pcb.CycleCounter.hpp"
+#include "FreeRTOS.h"
+
+namespace eoos
+{
+namespace
+{
+
+/**
+ * @brief Number of interrupts to measure latency of a handler.
+ */
+const int32_t NUMBER_OF_INTERRUPTS(1000);
+
+/**
+ * @brief Interrupt request which is not used by the board and requested by software.
+ */
+const int32_t IRQ( pcb::Nvic::IRQ_TIM7 );
+
+/**
+ * @brief CPU cycles of the last interrupt entry.
+ */
+uint32_t volatile time_( 0U );
+
+/**
+ * @brief Number of interrupts handled.
+ */
+int32_t volatile count_( 0 );
+
+/**
+ * @brief Handler bound to the interrupt at compile-time.
+ */
+void handleStatic()
+{
+    time_ = pcb::CycleCounter::get();
+    count_ = count_ + 1;
+}
+
+typedef pcb::StaticInterrupt<IRQ, &handleStatic> Interrupt; ///< The interrupt of the static handler.
+
+/**
+ * @class DynamicHandler
+ * @brief Handler bound to the interrupt at run-time.
+ */
+class DynamicHandler : public pcb::Handler
+{
+
+public:
+
+    /**
+     * @copydoc eoos::pcb::Handler::handle()
+     */
+    virtual void handle()
+    {
+        time_ = pcb::CycleCounter::get();
+        count_ = count_ + 1;
+    }
+
+};
+
+/**
+ * @struct Latency
+ * @brief Statistics of the interrupt entry latency.
+ */
+struct Latency
+{
+    uint32_t min; ///< Minimum latency in cycles.
+    uint32_t max; ///< Maximum latency in cycles.
+    uint32_t sum; ///< Sum of latencies in cycles.
+};
+
+Latency measureLatency()
+{
+    Latency latency = { 0xFFFFFFFFU, 0U, 0U };
+    for(int32_t i(0); i<NUMBER_OF_INTERRUPTS; i++)
+    {
+        int32_t const count( count_ );
+        uint32_t const start( pcb::CycleCounter::get() );
+        Interrupt::trigger();
+        while( count_ == count ){}
+        uint32_t const cycles( time_ - start );
+        latency.min = (cycles < latency.min) ? cycles : latency.min;
+        latency.max = (cycles > latency.max) ? cycles : latency.max;
+        latency.sum += cycles;
+    }
+    return latency;
+}
+
+void printLatency(char_t const* path, Latency const& latency)
+{
+    lib::Stream::cout() << "INTERRUPT: Minimum latency of " << path << " " << static_cast<int32_t>(latency.min) << " cycles\r\n";
+    lib::Stream::cout() << "INTERRUPT: Average latency of " << path << " " << static_cast<int32_t>(latency.sum / NUMBER_OF_INTERRUPTS) << " cycles\r\n";
+    lib::Stream::cout() << "INTERRUPT: Maximum latency of " << path << " " << static_cast<int32_t>(latency.max) << " cycles\r\n";
+}
+
+} // namespace
+
+void testStaticInterrupt()
+{
+    if( !Interrupt::bind() )
+    {   // Failure
+        TestRunner::fail();
+    }
+    Interrupt::setPriority(configMAX_SYSCALL_INTERRUPT_PRIORITY);
+    Interrupt::enable();
+    Latency const direct( measureLatency() );
+    DynamicHandler handler;
+    if( !pcb::Nvic::bind(IRQ, handler) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    Latency const dispatched( measureLatency() );
+    Interrupt::disable();
+    if( count_ != NUMBER_OF_INTERRUPTS * 2 )
+    {   // Failure
+        TestRunner::fail();
+    }
+    printLatency("static handler", direct);
+    printLatency("dynamic handler", dispatched);
+    // Success
+}
+
+namespace
+{
+
+/**
+ * @brief Registration of the suite.
+ */
+TestSuite const suite_("static-interrupt", testStaticInterrupt, TestSuite::TYPE_BENCHMARK, 30000);
+
+} // namespace
+
+} // namespace eoos
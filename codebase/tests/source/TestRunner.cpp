@@ -0,0 +1,347 @@
+/**
+ * @file      TestRunner.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Runner of test suites.
+ */
+#include "TestRunner.hpp"
+#include "lib.Stream.hpp"
+#include "pcb.Clock.hpp"
+#include "pcb.Formatter.hpp"
+#include "pcb.Register.hpp"
+#include "pcb.UsartReceiver.hpp"
+
+namespace eoos
+{
+namespace
+{
+
+typedef pcb::Peripheral<0xE000ED00U> Scb;                       ///< System control block.
+typedef pcb::Register<Scb, 0x04U> ScbIcsr;                     ///< Interrupt control and state register.
+typedef pcb::RegisterField<ScbIcsr, 0U, 9U> ScbIcsrVectactive; ///< Number of the active exception.
+
+/**
+ * @brief Names of suite types.
+ */
+char_t const* const TYPE_NAMES[3] = { "test", "benchmark", "manual" };
+
+} // namespace
+
+TestRunner* TestRunner::runner_( NULLPTR );
+
+StackType_t TestRunner::stack_[STACK_SIZE / sizeof(StackType_t)];
+
+StaticTask_t TestRunner::control_;
+
+TestRunner::TestRunner()
+    : lib::NonCopyable<lib::NoAllocator>()
+    , suites_()
+    , number_( 0 )
+    , suite_( NULLPTR )
+    , result_( RESULT_PASSED )
+    , task_( NULLPTR )
+    , notifier_( pcb::Notifier::TYPE_BINARY )
+    , isBailedOut_( false ) {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+TestRunner::~TestRunner()
+{
+    if( runner_ == this )
+    {
+        runner_ = NULLPTR;
+    }
+}
+
+int32_t TestRunner::execute(int32_t const argc, char_t* argv[])
+{
+    int32_t res( -1 );
+    do
+    {
+        if( !isConstructed() )
+        {
+            break;
+        }
+        if( argc > 1 )
+        {
+            number_ = 0;
+            bool_t isValid( true );
+            for(int32_t i(1); i<argc; i++)
+            {
+                isValid &= parse(argv[i]);
+            }
+            if( isValid )
+            {
+                res = run();
+            }
+            break;
+        }
+        pcb::UsartReceiver receiver( pcb::UsartReceiver::NUMBER_USART1, notifier_ );
+        if( !receiver.isConstructed() )
+        {
+            break;
+        }
+        char_t command[COMMAND_SIZE];
+        int32_t timeout( COMMAND_TIMEOUT );
+        while(true)
+        {
+            lib::Stream::cout() << "# Enter suites, 'tests', 'benchmarks', 'all' or 'list', an empty command runs 'all'\r\n";
+            int32_t const length( receiver.readLine(command, COMMAND_SIZE, timeout) );
+            timeout = pcb::UsartReceiver::TIMEOUT_INFINITE;
+            number_ = 0;
+            bool_t const isValid( (length > 0) ? parse(command) : select("all") );
+            if( isValid )
+            {
+                res = run();
+            }
+            if( isBailedOut_ )
+            {
+                break;
+            }
+        }
+    } while(false);
+    return res;
+}
+
+void TestRunner::fail()
+{
+    TestRunner* const runner( runner_ );
+    if( (runner != NULLPTR) && (runner->suite_ != NULLPTR) && (ScbIcsrVectactive::read() == 0U) )
+    {
+        runner->complete(RESULT_FAILED);
+    }
+    while(true){}
+}
+
+bool_t TestRunner::construct()
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {
+            break;
+        }
+        if( runner_ != NULLPTR )
+        {
+            break;
+        }
+        if( !notifier_.bind() )
+        {
+            break;
+        }
+        runner_ = this;
+        res = true;
+    } while(false);
+    return res;
+}
+
+bool_t TestRunner::parse(char_t* const command)
+{
+    bool_t res( true );
+    char_t* word( command );
+    while( *word != '\0' )
+    {
+        char_t* end( word );
+        while( (*end != '\0') && (*end != ' ') && (*end != ',') )
+        {
+            end++;
+        }
+        bool_t const isLast( *end == '\0' );
+        *end = '\0';
+        if( end != word )
+        {
+            res &= select(word);
+        }
+        if( isLast )
+        {
+            break;
+        }
+        word = end + 1;
+    }
+    return res;
+}
+
+bool_t TestRunner::select(char_t const* const word)
+{
+    bool_t res( true );
+    if( TestSuite::compare(word, "all") == 0 )
+    {
+        res &= select(TestSuite::TYPE_TEST);
+        res &= select(TestSuite::TYPE_BENCHMARK);
+    }
+    else if( TestSuite::compare(word, "tests") == 0 )
+    {
+        res = select(TestSuite::TYPE_TEST);
+    }
+    else if( TestSuite::compare(word, "benchmarks") == 0 )
+    {
+        res = select(TestSuite::TYPE_BENCHMARK);
+    }
+    else if( TestSuite::compare(word, "list") == 0 )
+    {
+        printList();
+    }
+    else
+    {
+        TestSuite const* const suite( TestSuite::find(word) );
+        if( suite != NULLPTR )
+        {
+            res = select(*suite);
+        }
+        else
+        {
+            lib::Stream::cout() << "# Unknown suite " << word << "\r\n";
+            res = false;
+        }
+    }
+    return res;
+}
+
+bool_t TestRunner::select(TestSuite::Type const type)
+{
+    bool_t res( true );
+    for(TestSuite const* suite( TestSuite::getFirst() ); suite != NULLPTR; suite = suite->getNext())
+    {
+        if( suite->getType() == type )
+        {
+            res &= select(*suite);
+        }
+    }
+    return res;
+}
+
+bool_t TestRunner::select(TestSuite const& suite)
+{
+    bool_t res( false );
+    if( number_ < MAXIMUM_SUITES )
+    {
+        suites_[number_++] = &suite;
+        res = true;
+    }
+    else
+    {
+        lib::Stream::cout() << "# Too many suites, " << MAXIMUM_SUITES << " suites are run at most\r\n";
+    }
+    return res;
+}
+
+int32_t TestRunner::run()
+{
+    int32_t res( 0 );
+    if( number_ > 0 )
+    {
+        pcb::Formatter formatter( lib::Stream::cout() );
+        formatter << "TAP version 13\r\n" << "1.." << number_ << "\r\n";
+        for(int32_t i(0); i<number_; i++)
+        {
+            TestSuite const& suite( *suites_[i] );
+            uint64_t cycles( 0U );
+            int32_t stack( 0 );
+            Result const result( run(suite, &cycles, &stack) );
+            if( result != RESULT_PASSED )
+            {
+                formatter << "not ";
+                res++;
+            }
+            formatter << "ok " << (i + 1) << " - " << suite.getName() << "\r\n";
+            formatter << "  ---\r\n";
+            if( result == RESULT_FAILED )
+            {
+                formatter << "  message: failed\r\n";
+            }
+            else if( result == RESULT_TIMEOUT )
+            {
+                formatter << "  message: timeout of " << suite.getTimeout() << " ms expired\r\n";
+            }
+            formatter << "  cycles: " << cycles << "\r\n";
+            formatter << "  stack: " << stack << "\r\n";
+            formatter << "  ...\r\n";
+            if( result != RESULT_PASSED )
+            {
+                // The suites not run are counted as failed
+                formatter << "Bail out! Objects of " << suite.getName() << " are left on the stack of suites\r\n";
+                res += number_ - i - 1;
+                isBailedOut_ = true;
+                break;
+            }
+        }
+        formatter << "# Failed " << res << " of " << number_ << " suites\r\n";
+    }
+    return res;
+}
+
+TestRunner::Result TestRunner::run(TestSuite const& suite, uint64_t* const cycles, int32_t* const stack)
+{
+    Result res( RESULT_FAILED );
+    suite_ = &suite;
+    result_ = RESULT_RUNNING;
+    // Drop a notification of the previous suite which has completed just after its timeout expired
+    static_cast<void>( notifier_.clear() );
+    uint64_t const start( pcb::Clock::getCycles() );
+    // The depth of a stack is given to the kernel in words
+    uint32_t const depth( static_cast<uint32_t>(sizeof(stack_) / sizeof(StackType_t)) );
+    task_ = xTaskCreateStatic(handleTask, suite.getName(), depth, this, uxTaskPriorityGet(NULLPTR), stack_, &control_);
+    if( task_ != NULLPTR )
+    {
+        static_cast<void>( notifier_.wait( suite.getTimeout() ) );
+        *cycles = pcb::Clock::getCycles() - start;
+        taskENTER_CRITICAL();
+        if( result_ == RESULT_RUNNING )
+        {
+            result_ = RESULT_TIMEOUT;
+        }
+        taskEXIT_CRITICAL();
+        uint32_t const unused( static_cast<uint32_t>( uxTaskGetStackHighWaterMark(task_) ) );
+        *stack = static_cast<int32_t>( sizeof(stack_) - unused * sizeof(StackType_t) );
+        vTaskDelete(task_);
+        task_ = NULLPTR;
+        res = result_;
+    }
+    suite_ = NULLPTR;
+    return res;
+}
+
+void TestRunner::complete(Result const result)
+{
+    taskENTER_CRITICAL();
+    if( result_ == RESULT_RUNNING )
+    {
+        result_ = result;
+        static_cast<void>( notifier_.notify() );
+    }
+    taskEXIT_CRITICAL();
+    while(true)
+    {
+        vTaskSuspend(NULLPTR);
+    }
+}
+
+void TestRunner::printList()
+{
+    pcb::Formatter formatter( lib::Stream::cout() );
+    for(TestSuite const* suite( TestSuite::getFirst() ); suite != NULLPTR; suite = suite->getNext())
+    {
+        formatter << "# " << suite->getName() << " " << TYPE_NAMES[suite->getType()] << " ";
+        if( suite->getTimeout() == TestSuite::TIMEOUT_INFINITE )
+        {
+            formatter << "infinite\r\n";
+        }
+        else
+        {
+            formatter << suite->getTimeout() << " ms\r\n";
+        }
+    }
+}
+
+void TestRunner::handleTask(void* const argument)
+{
+    TestRunner* const runner( static_cast<TestRunner*>(argument) );
+    TestSuite::Function const function( runner->suite_->getFunction() );
+    function();
+    runner->complete(RESULT_PASSED);
+}
+
+} // namespace eoos
@@ -0,0 +1,80 @@
+/**
+ * @file      TestSuite.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Registry of test suites.
+ */
+#include "TestSuite.hpp"
+
+namespace eoos
+{
+
+TestSuite* TestSuite::suites_( NULLPTR );
+
+TestSuite::TestSuite(char_t const* const name, Function const function, Type const type, int32_t const timeout)
+    : name_( name )
+    , function_( function )
+    , type_( type )
+    , timeout_( timeout )
+    , next_( NULLPTR ) {
+    TestSuite** link( &suites_ );
+    while( (*link != NULLPTR) && (compare((*link)->name_, name_) < 0) )
+    {
+        link = &(*link)->next_;
+    }
+    next_ = *link;
+    *link = this;
+}
+
+char_t const* TestSuite::getName() const
+{
+    return name_;
+}
+
+TestSuite::Function TestSuite::getFunction() const
+{
+    return function_;
+}
+
+TestSuite::Type TestSuite::getType() const
+{
+    return type_;
+}
+
+int32_t TestSuite::getTimeout() const
+{
+    return timeout_;
+}
+
+TestSuite const* TestSuite::getNext() const
+{
+    return next_;
+}
+
+TestSuite const* TestSuite::getFirst()
+{
+    return suites_;
+}
+
+TestSuite const* TestSuite::find(char_t const* const name)
+{
+    TestSuite const* suite( suites_ );
+    while( (suite != NULLPTR) && (compare(suite->name_, name) != 0) )
+    {
+        suite = suite->next_;
+    }
+    return suite;
+}
+
+int32_t TestSuite::compare(char_t const* str1, char_t const* str2)
+{
+    while( (*str1 != '\0') && (*str1 == *str2) )
+    {
+        str1++;
+        str2++;
+    }
+    return static_cast<int32_t>(*str1) - static_cast<int32_t>(*str2);
+}
+
+} // namespace eoos
@@ -6,6 +6,7 @@
  * @brief Tests of thread yield.
  */
 #include "ThreadYieldTest.hpp"
+#include "TestSuite.hpp"
 #include "lib.AbstractThreadTask.hpp"
 
 namespace eoos
@@ -75,4 +76,14 @@ void testThreadYield()
     }
 }
 
+namespace
+{
+
+/**
+ * @brief Registration of the suite.
+ */
+TestSuite const suite_("thread-yield", testThreadYield, TestSuite::TYPE_MANUAL, TestSuite::TIMEOUT_INFINITE);
+
+} // namespace
+
 } // namespace eoos
@@ -0,0 +1,373 @@
+/**
+ * @file      TimerTest.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of software timers.
+ */
+#include "TimerTest.hpp"
+#include "TestRunner.hpp"
+#include "lib.AbstractThreadTask.hpp"
+#include "lib.Thread.hpp"
+#include "lib.Stream.hpp"
+#include "pcb.Timer.hpp"
+#include "pcb.TimerWheel.hpp"
+#include "pcb.CycleCounter.hpp"
+
+namespace eoos
+{
+namespace
+{
+
+const int32_t PERIOD(10);
+const int32_t NUMBER_OF_PERIODS(100);
+const int32_t NUMBER_OF_WHEEL_TIMERS(200);
+
+/**
+ * @class Period
+ * @brief Statistics of dispatch periods.
+ */
+class Period
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    Period() :
+        count_ (0),
+        last_ (0U),
+        min_ (0xFFFFFFFFU),
+        max_ (0U){
+    }
+
+    /**
+     * @brief Records a dispatch.
+     */
+    void record()
+    {
+        uint32_t const now( pcb::CycleCounter::get() );
+        if( count_ != 0 )
+        {
+            uint32_t const delta( now - last_ );
+            min_ = (delta < min_) ? delta : min_;
+            max_ = (delta > max_) ? delta : max_;
+        }
+        last_ = now;
+        count_++;
+    }
+
+    /**
+     * @brief Returns number of dispatches.
+     *
+     * @return Number of dispatches.
+     */
+    int32_t getCount() const
+    {
+        return count_;
+    }
+
+    /**
+     * @brief Returns jitter of dispatches.
+     *
+     * @return Difference between maximum and minimum periods in CPU cycles.
+     */
+    int32_t getJitter() const
+    {
+        return (count_ > 1) ? static_cast<int32_t>(max_ - min_) : 0;
+    }
+
+private:
+
+    int32_t volatile count_; ///< Number of dispatches.
+    uint32_t last_;          ///< Cycles of the last dispatch.
+    uint32_t min_;           ///< Minimum period.
+    uint32_t max_;           ///< Maximum period.
+};
+
+/**
+ * @class TimerHandler
+ * @brief Handler of a software timer.
+ */
+class TimerHandler : public pcb::Handler
+{
+
+public:
+
+    /**
+     * @copydoc eoos::pcb::Handler::handle()
+     */
+    virtual void handle()
+    {
+        period_.record();
+    }
+
+    /**
+     * @brief Returns period statistics.
+     *
+     * @return Statistics.
+     */
+    Period const& getPeriod() const
+    {
+        return period_;
+    }
+
+private:
+
+    Period period_; ///< Period statistics.
+};
+
+/**
+ * @class PeriodicThread
+ * @brief Thread executing a periodic job by sleeping.
+ */
+class PeriodicThread : public lib::AbstractThreadTask<>
+{
+    typedef AbstractThreadTask<> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    PeriodicThread() : Parent(),
+        period_ (){
+    }
+
+    /**
+     * @brief Returns period statistics.
+     *
+     * @return Statistics.
+     */
+    Period const& getPeriod() const
+    {
+        return period_;
+    }
+
+private:
+
+    /**
+     * @copydoc eoos::api::Task::start()
+     */
+    virtual void start()
+    {
+        for(int32_t i(0); i<NUMBER_OF_PERIODS; i++)
+        {
+            period_.record();
+            lib::Thread<>::sleep(PERIOD);
+        }
+    }
+
+    Period period_; ///< Period statistics.
+};
+
+/**
+ * @class WheelTimer
+ * @brief Timer of a timer wheel counting its expirations.
+ */
+class WheelTimer : public pcb::Handler
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    WheelTimer() :
+        entry_ (*this),
+        count_ (0){
+    }
+
+    /**
+     * @copydoc eoos::pcb::Handler::handle()
+     */
+    virtual void handle()
+    {
+        count_++;
+    }
+
+    /**
+     * @brief Returns the wheel entry.
+     *
+     * @return The entry.
+     */
+    pcb::TimerWheel::Entry& getEntry()
+    {
+        return entry_;
+    }
+
+    /**
+     * @brief Returns number of expirations.
+     *
+     * @return Number of expirations.
+     */
+    int32_t getCount() const
+    {
+        return count_;
+    }
+
+    /**
+     * @brief Resets number of expirations.
+     */
+    void resetCount()
+    {
+        count_ = 0;
+    }
+
+private:
+
+    pcb::TimerWheel::Entry entry_; ///< Entry of the wheel.
+    int32_t volatile count_;       ///< Number of expirations.
+};
+
+/**
+ * @class WheelTick
+ * @brief Handler of a software timer advancing a timer wheel.
+ */
+class WheelTick : public pcb::Handler
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param wheel Timer wheel to advance.
+     */
+    explicit WheelTick(pcb::TimerWheel& wheel) :
+        wheel_ (wheel){
+    }
+
+    /**
+     * @copydoc eoos::pcb::Handler::handle()
+     */
+    virtual void handle()
+    {
+        wheel_.tick();
+    }
+
+private:
+
+    pcb::TimerWheel& wheel_; ///< Timer wheel to advance.
+};
+
+/**
+ * @brief Timers of the timer wheel test.
+ *
+ * @note The timers are static as they do not fit a thread stack.
+ */
+WheelTimer wheelTimers_[NUMBER_OF_WHEEL_TIMERS];
+
+void testTimerOneShot()
+{
+    TimerHandler handler;
+    pcb::Timer timer(handler, pcb::Timer::MODE_ONE_SHOT, PERIOD);
+    if( !timer.isConstructed() )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( !timer.start() )
+    {   // Failure
+        TestRunner::fail();
+    }
+    lib::Thread<>::sleep(PERIOD * 5);
+    if( handler.getPeriod().getCount() != 1 )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( timer.isActive() )
+    {   // Failure
+        TestRunner::fail();
+    }
+}
+
+void testTimerPeriodic()
+{
+    TimerHandler handler;
+    pcb::Timer timer(handler, pcb::Timer::MODE_PERIODIC, PERIOD);
+    if( !timer.start() )
+    {   // Failure
+        TestRunner::fail();
+    }
+    while( handler.getPeriod().getCount() < NUMBER_OF_PERIODS )
+    {
+        lib::Thread<>::sleep(PERIOD);
+    }
+    if( !timer.stop() )
+    {   // Failure
+        TestRunner::fail();
+    }
+    PeriodicThread thread;
+    if( !thread.execute() )
+    {   // Failure
+        TestRunner::fail();
+    }
+    thread.join();
+    lib::Stream::cout() << "TIMER: Jitter of timer " << handler.getPeriod().getJitter() << " cycles\r\n";
+    lib::Stream::cout() << "TIMER: Jitter of thread " << thread.getPeriod().getJitter() << " cycles\r\n";
+    lib::Stream::cout() << "TIMER: Memory of timer " << static_cast<int32_t>(sizeof(pcb::Timer)) << " Bytes\r\n";
+    lib::Stream::cout() << "TIMER: Memory of thread " << static_cast<int32_t>(sizeof(PeriodicThread) + EOOS_GLOBAL_SYS_FREERTOS_TASK_STACK_SIZE) << " Bytes\r\n";
+}
+
+void testTimerWheel()
+{
+    pcb::TimerWheel wheel;
+    WheelTick tick(wheel);
+    pcb::Timer timer(tick, pcb::Timer::MODE_PERIODIC, 1);
+    // The timers are static, so the expirations of a previous run of the suite are dropped
+    for(int32_t i(0); i<NUMBER_OF_WHEEL_TIMERS; i++)
+    {
+        wheelTimers_[i].resetCount();
+    }
+    uint32_t const start( pcb::CycleCounter::get() );
+    for(int32_t i(0); i<NUMBER_OF_WHEEL_TIMERS; i++)
+    {
+        uint32_t const delay( static_cast<uint32_t>(i + 1) );
+        if( !wheel.start(wheelTimers_[i].getEntry(), delay) )
+        {   // Failure
+            TestRunner::fail();
+        }
+    }
+    uint32_t const cycles( pcb::CycleCounter::get() - start );
+    if( !timer.start() )
+    {   // Failure
+        TestRunner::fail();
+    }
+    lib::Thread<>::sleep(NUMBER_OF_WHEEL_TIMERS * 2);
+    if( !timer.stop() )
+    {   // Failure
+        TestRunner::fail();
+    }
+    for(int32_t i(0); i<NUMBER_OF_WHEEL_TIMERS; i++)
+    {
+        if( wheelTimers_[i].getCount() != 1 )
+        {   // Failure
+            TestRunner::fail();
+        }
+    }
+    lib::Stream::cout() << "TIMER: Start of wheel timer " << static_cast<int32_t>(cycles / NUMBER_OF_WHEEL_TIMERS) << " cycles\r\n";
+    lib::Stream::cout() << "TIMER: Memory of wheel timer " << static_cast<int32_t>(sizeof(pcb::TimerWheel::Entry)) << " Bytes\r\n";
+}
+
+} // namespace
+
+void testTimer()
+{
+    testTimerOneShot();
+    testTimerPeriodic();
+    testTimerWheel();
+    // Success
+}
+
+namespace
+{
+
+/**
+ * @brief Registration of the suite.
+ */
+TestSuite const suite_("timer", testTimer, TestSuite::TYPE_TEST, 30000);
+
+} // namespace
+
+} // namespace eoos
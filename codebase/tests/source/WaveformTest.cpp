@@ -0,0 +1,207 @@
+/**
+ * @file      WaveformTest.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of DMA driven GPIO waveform.
+ */
+#include "WaveformTest.hpp"
+#include "TestRunner.hpp"
+#include "lib.Stream.hpp"
+#include "pcb.Waveform.hpp"
+#include "pcb.ClockScaler.hpp"
+#include "pcb.CycleCounter.hpp"
+
+namespace eoos
+{
+namespace
+{
+
+const int32_t RATE(1000000);
+const int32_t LENGTH(64);
+const int32_t NUMBER_OF_FILLS(100);
+
+/**
+ * @brief LED1 on PB1 of the board.
+ */
+const uint32_t LED( 0x0002U );
+
+/**
+ * @class Source
+ * @brief Source of a square wave which measures intervals of its calls.
+ */
+class Source : public pcb::Waveform::Source
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    Source()
+        : pcb::Waveform::Source()
+        , fills_( 0 )
+        , first_( 0U )
+        , last_( 0U ) {
+    }
+
+    /**
+     * @brief Returns number of the fill calls.
+     *
+     * @return Number of calls.
+     */
+    int32_t getFills() const
+    {
+        return fills_;
+    }
+
+    /**
+     * @brief Returns mean interval between the fill calls.
+     *
+     * @return Cycles, or zero if the function has been called less than twice.
+     */
+    uint32_t getInterval() const
+    {
+        uint32_t interval( 0U );
+        if( fills_ > 1 )
+        {
+            interval = (last_ - first_) / static_cast<uint32_t>(fills_ - 1);
+        }
+        return interval;
+    }
+
+    /**
+     * @copydoc eoos::pcb::Waveform::Source::fill(uint32_t*,int32_t)
+     */
+    virtual void fill(uint32_t* const words, int32_t const length)
+    {
+        uint32_t const time( pcb::CycleCounter::get() );
+        if( fills_ == 0 )
+        {
+            first_ = time;
+        }
+        last_ = time;
+        for(int32_t i(0); i<length; i++)
+        {
+            words[i] = pcb::Waveform::getWord(LED, ((i & 1) == 0) ? LED : 0U);
+        }
+        fills_ = fills_ + 1;
+    }
+
+private:
+
+    int32_t volatile fills_;  ///< Number of the fill calls.
+    uint32_t volatile first_; ///< Cycles of the first call.
+    uint32_t volatile last_;  ///< Cycles of the last call.
+
+};
+
+uint32_t buffer[LENGTH];
+
+void testWaveformOnce(pcb::Waveform& waveform)
+{
+    for(int32_t i(0); i<LENGTH; i++)
+    {
+        buffer[i] = pcb::Waveform::getWord(LED, ((i & 1) == 0) ? LED : 0U);
+    }
+    uint32_t const start( pcb::CycleCounter::get() );
+    if( !waveform.write(buffer, LENGTH) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    while( waveform.isActive() ){}
+    uint32_t const cycles( pcb::CycleCounter::get() - start );
+    uint32_t const expected( static_cast<uint32_t>(LENGTH) * static_cast<uint32_t>(pcb::ClockScaler::getFrequencies().hclk / static_cast<uint32_t>(waveform.getRate())) );
+    if( (cycles < expected) || (cycles > expected + expected / 10U) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( !waveform.write(buffer, LENGTH) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( !waveform.wait(pcb::Waveform::TIMEOUT_INFINITE) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( !waveform.write(buffer, LENGTH) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    waveform.stop();
+    if( waveform.isActive() )
+    {   // Failure
+        TestRunner::fail();
+    }
+    lib::Stream::cout() << "WAVEFORM: Writing of " << LENGTH << " words " << static_cast<int32_t>(cycles) << " cycles\r\n";
+}
+
+void testWaveformContinuous(pcb::Waveform& waveform)
+{
+    Source source;
+    if( waveform.start(buffer, LENGTH - 1, &source) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    source.fill(buffer, LENGTH);
+    if( !waveform.start(buffer, LENGTH, &source) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    while( source.getFills() < NUMBER_OF_FILLS + 1 ){}
+    waveform.stop();
+    uint32_t const interval( source.getInterval() );
+    uint32_t const expected( static_cast<uint32_t>(LENGTH / 2) * static_cast<uint32_t>(pcb::ClockScaler::getFrequencies().hclk / static_cast<uint32_t>(waveform.getRate())) );
+    if( (interval < expected - expected / 100U) || (interval > expected + expected / 100U) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( waveform.getUnderruns() != 0U )
+    {   // Failure
+        TestRunner::fail();
+    }
+    lib::Stream::cout() << "WAVEFORM: Interval of halves " << static_cast<int32_t>(interval) << " cycles\r\n";
+    lib::Stream::cout() << "WAVEFORM: Expected interval of halves " << static_cast<int32_t>(expected) << " cycles\r\n";
+}
+
+} // namespace
+
+void testWaveform()
+{
+    pcb::Waveform::Config config = {
+        .port = pcb::GpioPort::NUMBER_B,
+        .mask = LED,
+        .rate = RATE
+    };
+    pcb::Waveform waveform( config );
+    if( !waveform.isConstructed() )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( waveform.getRate() != RATE )
+    {   // Failure
+        TestRunner::fail();
+    }
+    {
+        pcb::Waveform second( config );
+        if( second.isConstructed() )
+        {   // Failure
+            TestRunner::fail();
+        }
+    }
+    testWaveformOnce(waveform);
+    testWaveformContinuous(waveform);
+    // Success
+}
+
+namespace
+{
+
+/**
+ * @brief Registration of the suite.
+ */
+TestSuite const suite_("waveform", testWaveform, TestSuite::TYPE_TEST, 30000);
+
+} // namespace
+
+} // namespace eoos
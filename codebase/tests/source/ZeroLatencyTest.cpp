@@ -0,0 +1,141 @@
+/**
+ * @file      ZeroLatencyTest.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Tests of zero-latency interrupts and BASEPRI critical sections.
+ */
+#include "ZeroLatencyTest.hpp"
+#include "TestRunner.hpp"
+#include "lib.Stream.hpp"
+#include "pcb.ZeroLatencyInterrupt.hpp"
+#include "pcb.CriticalSection.hpp"
+#include "pcb.CycleCounter.hpp"
+#include "pcb.ZeroLatencyGuard.hpp"
+
+namespace eoos
+{
+namespace
+{
+
+/**
+ * @brief Number of critical sections to measure the maximum latencies.
+ */
+const int32_t NUMBER_OF_SECTIONS(100);
+
+/**
+ * @brief Length of a critical section in CPU cycles.
+ */
+const uint32_t SECTION( 10000U );
+
+uint32_t volatile zeroTime_( 0U );   ///< CPU cycles of the last zero-latency interrupt entry.
+uint32_t volatile kernelTime_( 0U ); ///< CPU cycles of the last kernel interrupt entry.
+
+/**
+ * @brief Handler of the zero-latency interrupt, which is masked by no critical section of the kernel.
+ */
+void handleZero()
+{
+    zeroTime_ = pcb::CycleCounter::get();
+}
+
+/**
+ * @brief Handler of the kernel interrupt, which is masked by the critical sections.
+ */
+void handleKernel()
+{
+    kernelTime_ = pcb::CycleCounter::get();
+}
+
+typedef pcb::ZeroLatencyInterrupt<pcb::Nvic::IRQ_TIM6, &handleZero> ZeroInterrupt; ///< The zero-latency interrupt.
+typedef pcb::StaticInterrupt<pcb::Nvic::IRQ_TIM7, &handleKernel> KernelInterrupt;  ///< The kernel interrupt.
+
+/**
+ * @brief Triggers both the interrupts and spins in a critical section.
+ *
+ * @return CPU cycles of the interrupt request.
+ */
+uint32_t spin()
+{
+    uint32_t const start( pcb::CycleCounter::get() );
+    ZeroInterrupt::trigger();
+    KernelInterrupt::trigger();
+    while( (pcb::CycleCounter::get() - start) < SECTION ){}
+    return start;
+}
+
+void testZeroLatencyGlobal(uint32_t* const zero, uint32_t* const kernel)
+{
+    for(int32_t i(0); i<NUMBER_OF_SECTIONS; i++)
+    {
+        __asm volatile ("cpsid i" : : : "memory");
+        uint32_t const start( spin() );
+        __asm volatile ("cpsie i" : : : "memory");
+        uint32_t const zeroLatency( zeroTime_ - start );
+        uint32_t const kernelLatency( kernelTime_ - start );
+        *zero = (zeroLatency > *zero) ? zeroLatency : *zero;
+        *kernel = (kernelLatency > *kernel) ? kernelLatency : *kernel;
+    }
+}
+
+void testZeroLatencyBasepri(uint32_t* const zero, uint32_t* const kernel)
+{
+    for(int32_t i(0); i<NUMBER_OF_SECTIONS; i++)
+    {
+        uint32_t start( 0U );
+        {
+            pcb::CriticalSection const section;
+            start = spin();
+        }
+        uint32_t const zeroLatency( zeroTime_ - start );
+        uint32_t const kernelLatency( kernelTime_ - start );
+        *zero = (zeroLatency > *zero) ? zeroLatency : *zero;
+        *kernel = (kernelLatency > *kernel) ? kernelLatency : *kernel;
+    }
+}
+
+} // namespace
+
+void testZeroLatency()
+{
+    if( !ZeroInterrupt::bind() || !KernelInterrupt::bind() )
+    {   // Failure
+        TestRunner::fail();
+    }
+    KernelInterrupt::setPriority(configMAX_SYSCALL_INTERRUPT_PRIORITY);
+    ZeroInterrupt::enable();
+    KernelInterrupt::enable();
+    uint32_t globalZero( 0U );
+    uint32_t globalKernel( 0U );
+    testZeroLatencyGlobal(&globalZero, &globalKernel);
+    uint32_t basepriZero( 0U );
+    uint32_t basepriKernel( 0U );
+    testZeroLatencyBasepri(&basepriZero, &basepriKernel);
+    ZeroInterrupt::disable();
+    KernelInterrupt::disable();
+    if( (globalZero < SECTION) || (globalKernel < SECTION) || (basepriKernel < SECTION) )
+    {   // Failure
+        TestRunner::fail();
+    }
+    if( basepriZero >= SECTION / 10U )
+    {   // Failure
+        TestRunner::fail();
+    }
+    lib::Stream::cout() << "ZEROLATENCY: Global section, zero-latency interrupt " << static_cast<int32_t>(globalZero) << " cycles\r\n";
+    lib::Stream::cout() << "ZEROLATENCY: Global section, kernel interrupt " << static_cast<int32_t>(globalKernel) << " cycles\r\n";
+    lib::Stream::cout() << "ZEROLATENCY: BASEPRI section, zero-latency interrupt " << static_cast<int32_t>(basepriZero) << " cycles\r\n";
+    lib::Stream::cout() << "ZEROLATENCY: BASEPRI section, kernel interrupt " << static_cast<int32_t>(basepriKernel) << " cycles\r\n";
+    // Success
+}
+
+namespace
+{
+
+/**
+ * @brief Registration of the suite.
+ */
+TestSuite const suite_("zero-latency", testZeroLatency, TestSuite::TYPE_BENCHMARK, 30000);
+
+} // namespace
+
+} // namespace eoos
@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+"""
+@file      baseline.py
+@brief     EOOS baseline of measurements of the tests firmware
+@author    Sergey Baigudin, sergey@baigudin.software
+@copyright 2024, Sergey Baigudin, Baigudin Software
+
+The module saves measurements as a JSON baseline and compares measurements with
+a saved baseline, so that a script fails a build by EXIT_REGRESSION exit code if
+any measurement grows. It is used by benchmark.py and footprint.py scripts.
+"""
+
+import json
+import os
+
+# Exit code if measurements exceed the baseline
+EXIT_REGRESSION = 2
+
+
+def save(path, data):
+    """
+    Saves data as JSON.
+
+    @param path Path to the file.
+    @param data Data to be saved.
+    """
+    with open(path, 'w') as stream:
+        json.dump(data, stream, indent=4, sort_keys=True)
+        stream.write('\n')
+
+
+def load(path):
+    """
+    Loads data of JSON.
+
+    @param path Path to the file.
+    @return Loaded data.
+    """
+    with open(path, 'r') as stream:
+        return json.load(stream)
+
+
+def check(path, measurements, compare, tolerance, title, success):
+    """
+    Compares measurements with a baseline and prints the regressions.
+
+    A baseline which is not found is not a regression, so that the first run passes.
+
+    @param path         Path to the baseline.
+    @param measurements Measurements to be compared.
+    @param compare      Function of measurements, a baseline and a tolerance, which returns a list of regression messages.
+    @param tolerance    Tolerance of the compare function.
+    @param title        Title of regression messages, such as BENCHMARK.
+    @param success      Message if no measurement exceeds the baseline, which is formatted with the path.
+    @return Zero, or EXIT_REGRESSION if any measurement exceeds the baseline.
+    """
+    res = 0
+    if not os.path.isfile(path):
+        print('\nBaseline %s is not found, save one with --save option' % path)
+    else:
+        messages = compare(measurements, load(path), tolerance)
+        print('')
+        for message in messages:
+            print('%s REGRESSION: %s' % (title, message))
+        if messages:
+            res = EXIT_REGRESSION
+        else:
+            print(success % path)
+    return res
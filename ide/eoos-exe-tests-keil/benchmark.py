@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+"""
+@file      benchmark.py
+@brief     EOOS collector of microbenchmark results of the tests firmware
+@author    Sergey Baigudin, sergey@baigudin.software
+@copyright 2024, Sergey Baigudin, Baigudin Software
+
+The script parses result lines of pcb::Benchmark in a log of the debug USART,
+or of a host run, and writes them as JSON. A run is appended to a history file
+to track trends, and a run is compared with a baseline to fail if the median
+of any benchmark grows.
+
+A result line, which is a TAP comment, is:
+    # BENCH name=<name> n=<samples> min=<min> median=<median> p99=<p99> max=<max> mean=<mean> stddev=<stddev> unit=cycles
+
+Usage:
+    benchmark.py [--label LABEL] [--save FILE] [--history FILE] [--baseline FILE] [--tolerance PERCENT] [LOG ...]
+"""
+
+import argparse
+import os
+import re
+import sys
+import time
+
+import baseline
+
+# Result line, which may be prefixed by other output of the line
+RESULT = re.compile(r'BENCH name=(\S+)((?: \w+=\S+)+)\s*$')
+# Field of a result line
+FIELD = re.compile(r' (\w+)=(\S+)')
+
+
+def parse(streams):
+    """
+    Parses result lines.
+
+    @param streams Streams of logs.
+    @return Dictionary of benchmark names to their results, of which the last one of a name is taken.
+    """
+    results = {}
+    for stream in streams:
+        for line in stream:
+            match = RESULT.search(line.rstrip('\r\n'))
+            if not match:
+                continue
+            result = {}
+            for key, value in FIELD.findall(match.group(2)):
+                result[key] = int(value) if value.isdigit() else value
+            results[match.group(1)] = result
+    return results
+
+
+def print_results(results):
+    """
+    Prints results.
+
+    @param results Results of benchmarks.
+    """
+    print('%-32s %6s %10s %10s %10s %10s %10s' % ('BENCHMARK', 'N', 'MIN', 'MEDIAN', 'P99', 'MAX', 'STDDEV'))
+    for name in sorted(results):
+        result = results[name]
+        print('%-32s %6d %10d %10d %10d %10d %10d' % (name, result.get('n', 0), result.get('min', 0), result.get('median', 0),
+                                                    result.get('p99', 0), result.get('max', 0), result.get('stddev', 0)))
+
+
+def compare(results, base, tolerance):
+    """
+    Compares medians of results with the baseline.
+
+    @param results   Results of benchmarks.
+    @param base      Results of the baseline.
+    @param tolerance Percent a median may grow by.
+    @return List of messages about benchmarks which have grown.
+    """
+    messages = []
+    for name in sorted(set(results) & set(base)):
+        median = results[name].get('median', 0)
+        was = base[name].get('median', 0)
+        if median * 100 > was * (100 + tolerance):
+            messages.append('%s: median grew from %d to %d cycles' % (name, was, median))
+    return messages
+
+
+def main(argv):
+    parser = argparse.ArgumentParser(description='EOOS microbenchmark results')
+    parser.add_argument('logs', nargs='*', help='logs with result lines, or standard input if none')
+    parser.add_argument('--label', help='label of the run in the history, such as a commit')
+    parser.add_argument('--save', metavar='FILE', help='save the results as JSON')
+    parser.add_argument('--history', metavar='FILE', help='append the results to a JSON history of runs')
+    parser.add_argument('--baseline', metavar='FILE', help='compare the results with saved ones')
+    parser.add_argument('--tolerance', type=int, default=0, metavar='PERCENT', help='percent a median may grow by')
+    args = parser.parse_args(argv[1:])
+    if args.logs:
+        streams = [open(path, 'r', errors='replace') for path in args.logs]
+    else:
+        streams = [sys.stdin]
+    results = parse(streams)
+    for stream in streams:
+        if stream is not sys.stdin:
+            stream.close()
+    print_results(results)
+    if args.save:
+        baseline.save(args.save, results)
+    if args.history:
+        history = baseline.load(args.history) if os.path.isfile(args.history) else []
+        history.append({'label': args.label, 'time': int(time.time()), 'results': results})
+        baseline.save(args.history, history)
+    res = 0
+    if args.baseline:
+        res = baseline.check(args.baseline, results, compare, args.tolerance, 'BENCHMARK', 'Benchmarks do not exceed baseline %s')
+    return res
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
@@ -0,0 +1,386 @@
+#!/usr/bin/env python3
+"""
+@file      footprint.py
+@brief     EOOS per-module FLASH and SRAM footprint of the tests firmware
+@author    Sergey Baigudin, sergey@baigudin.software
+@copyright 2024, Sergey Baigudin, Baigudin Software
+
+The script parses a GNU linker map file of the firmware and sums the sizes of
+input sections per EOOS software module, which is taken from the path of the
+source file in the Keil project. If a second map file is given, for example
+of the minimal build profile, the footprints of both are compared.
+
+Sizes of symbols are given by the symbols of the map file, and stack usage of
+functions is given by .su files, which GCC generates with -fstack-usage option.
+A footprint can be saved as a baseline, and a footprint is compared with the
+baseline to fail a build if any module grows.
+
+Usage:
+    footprint.py [--symbols N] [--stack DIR] [--save FILE] [--baseline FILE] [--tolerance BYTES] MAP [OTHER_MAP]
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+import xml.etree.ElementTree as ElementTree
+
+import baseline
+
+PROJECT = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'eoos-tests-if-freertos.uvprojx')
+
+MODULE_TOOLCHAIN = 'toolchain'
+MODULE_OTHER = 'other'
+
+# Input section of a map file with name, address, size and object file
+SECTION = re.compile(r'^ (\.\S+|COMMON)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$')
+# Input section which name is too long to be in one line with the other fields
+SECTION_NAME = re.compile(r'^ (\.\S+|COMMON)$')
+SECTION_TAIL = re.compile(r'^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$')
+# Symbol of an input section
+SYMBOL = re.compile(r'^\s+0x([0-9a-fA-F]+)\s+([A-Za-z_.$][\w.$]*)$')
+# Function of a .su file with its stack usage in bytes
+STACK = re.compile(r'^(.+):\d+:\d+:(.+)\t(\d+)\t(\S+)$')
+
+
+def get_modules(project):
+    """
+    Returns EOOS modules of object files of the Keil project.
+
+    @param project Path to the Keil project.
+    @return Dictionary of object file names without extension to module names.
+    """
+    modules = {}
+    for path in ElementTree.parse(project).getroot().iter('FilePath'):
+        parts = path.text.replace('\\', '/').split('/')
+        if 'codebase' not in parts:
+            continue
+        parts = parts[parts.index('codebase') + 1:]
+        module = parts[0]
+        if module == 'driver' and len(parts) > 2:
+            module = module + '/' + parts[1]
+        name = os.path.splitext(parts[-1])[0].lower()
+        modules[name] = module
+    return modules
+
+
+def get_kind(section):
+    """
+    Returns kind of an input section.
+
+    @param section Name of the section.
+    @return One of text, rodata, data, bss, or None for sections which are not loaded.
+    """
+    if section.startswith(('.text', '.glue_7', '.init', '.fini', '.exception_vectors', '.vfp11_veneer', '.v4_bx')):
+        return 'text'
+    if section.startswith(('.rodata', '.ARM.extab', '.ARM.exidx', '.eh_frame', '.preinit_array', '.init_array', '.fini_array')):
+        return 'rodata'
+    if section.startswith(('.data', '.ramfunc')):
+        return 'data'
+    if section.startswith(('.bss', 'COMMON')):
+        return 'bss'
+    return None
+
+
+def get_module(source, modules):
+    """
+    Returns EOOS module of an input file.
+
+    @param source  Object file, archive member of the map file, or source file of a .su file.
+    @param modules Dictionary of object file names to module names.
+    @return Module name.
+    """
+    if '.a(' in source:
+        return MODULE_TOOLCHAIN
+    name = os.path.splitext(os.path.basename(source.replace('\\', '/')))[0].lower()
+    return modules.get(name, MODULE_OTHER)
+
+
+def get_symbols(section, address, size, symbols):
+    """
+    Returns sizes of symbols of an input section.
+
+    The size of a symbol is the distance to the next symbol or to the end of the section.
+    If the section has no symbols, the name of a section generated by -ffunction-sections
+    or -fdata-sections option gives the symbol.
+
+    @param section Name of the section.
+    @param address Address of the section.
+    @param size    Size of the section.
+    @param symbols Symbols of the section as tuples of address and name.
+    @return List of tuples of symbol names and sizes.
+    """
+    inside = sorted(s for s in symbols if address <= s[0] < address + size)
+    if not inside:
+        dot = section.find('.', 1)
+        name = section[dot + 1:] if dot > 0 else section
+        return [(name, size)]
+    result = []
+    if inside[0][0] > address:
+        result.append((section, inside[0][0] - address))
+    for index, (start, name) in enumerate(inside):
+        end = inside[index + 1][0] if index + 1 < len(inside) else address + size
+        result.append((name, end - start))
+    return result
+
+
+def parse(path, modules):
+    """
+    Parses a map file.
+
+    @param path    Path to the map file.
+    @param modules Dictionary of object file names to module names.
+    @return List of input sections as dictionaries of module, source, section, kind, address, size and symbols.
+    """
+    sections = []
+    with open(path, 'r', errors='replace') as stream:
+        lines = stream.read().splitlines()
+    is_map = False
+    name = None
+    current = None
+    for line in lines:
+        if line.startswith('Linker script and memory map'):
+            is_map = True
+            continue
+        if not is_map:
+            continue
+        fields = None
+        full = SECTION.match(line)
+        tail = SECTION_TAIL.match(line)
+        if full is not None:
+            fields = full.groups()
+        elif name is not None and tail is not None:
+            fields = (name,) + tail.groups()
+        name = None
+        if fields is None:
+            symbol = SYMBOL.match(line)
+            if symbol is not None and current is not None:
+                current['symbols'].append((int(symbol.group(1), 16), symbol.group(2)))
+                continue
+            short = SECTION_NAME.match(line)
+            if short is not None:
+                name = short.group(1)
+            elif not line.startswith(' ' * 16):
+                current = None
+            continue
+        section, address, size, source = fields
+        address = int(address, 16)
+        size = int(size, 16)
+        kind = get_kind(section)
+        current = None
+        if kind is None or address == 0 or size == 0:
+            continue
+        source = source.strip()
+        current = {
+            'module': get_module(source, modules),
+            'source': source,
+            'section': section,
+            'kind': kind,
+            'address': address,
+            'size': size,
+            'symbols': [],
+        }
+        sections.append(current)
+    return sections
+
+
+def parse_stack(directory, modules):
+    """
+    Parses .su files of a directory.
+
+    @param directory Directory with .su files.
+    @param modules   Dictionary of object file names to module names.
+    @return List of functions as tuples of module, function, stack usage and its qualifier.
+    """
+    functions = []
+    for file in sorted(os.listdir(directory)):
+        if not file.endswith('.su'):
+            continue
+        with open(os.path.join(directory, file), 'r', errors='replace') as stream:
+            for line in stream.read().splitlines():
+                match = STACK.match(line)
+                if match is None:
+                    continue
+                source, function, usage, qualifier = match.groups()
+                functions.append((get_module(source, modules), function, int(usage), qualifier))
+    return functions
+
+
+def demangle(names):
+    """
+    Demangles C++ symbol names if c++filt is available.
+
+    @param names Symbol names.
+    @return Dictionary of names to demangled names.
+    """
+    names = list(names)
+    for tool in ('arm-none-eabi-c++filt', 'c++filt'):
+        try:
+            output = subprocess.run([tool], input='\n'.join(names), capture_output=True, text=True, check=True).stdout
+        except (OSError, subprocess.CalledProcessError):
+            continue
+        demangled = output.splitlines()
+        if len(demangled) == len(names):
+            return dict(zip(names, demangled))
+    return dict(zip(names, names))
+
+
+def summarize(sections, functions=None):
+    """
+    Sums sizes of input sections and maximum stack usage of functions per module.
+
+    @param sections  Input sections.
+    @param functions Functions with stack usage, or None.
+    @return Dictionary of module names to dictionaries of kinds to sizes.
+    """
+    summary = {}
+    for section in sections:
+        sizes = summary.setdefault(section['module'], get_empty())
+        sizes[section['kind']] += section['size']
+    for module, _, usage, _ in functions or []:
+        sizes = summary.setdefault(module, get_empty())
+        sizes['stack'] = max(sizes['stack'], usage)
+    return summary
+
+
+def get_empty():
+    """
+    Returns sizes of a module which has nothing.
+    """
+    return {'text': 0, 'rodata': 0, 'data': 0, 'bss': 0, 'stack': 0}
+
+
+def get_flash(sizes):
+    """
+    Returns FLASH size of a module.
+    """
+    return sizes['text'] + sizes['rodata'] + sizes['data']
+
+
+def get_sram(sizes):
+    """
+    Returns SRAM size of a module.
+    """
+    return sizes['data'] + sizes['bss']
+
+
+def print_summary(summary, other=None):
+    """
+    Prints footprint per module.
+
+    @param summary Footprint of the firmware.
+    @param other   Footprint of the firmware to compare with, or None.
+    """
+    names = sorted(set(summary) | set(other or {}))
+    if other is None:
+        print('%-16s %8s %8s %8s %8s %8s %8s %8s' % ('MODULE', 'TEXT', 'RODATA', 'DATA', 'BSS', 'FLASH', 'SRAM', 'STACK'))
+    else:
+        print('%-16s %8s %8s %8s %8s %8s %8s' % ('MODULE', 'FLASH', 'SRAM', 'FLASH', 'SRAM', 'DFLASH', 'DSRAM'))
+    total = None
+    for name in names:
+        sizes = summary.get(name, get_empty())
+        if other is None:
+            row = [sizes['text'], sizes['rodata'], sizes['data'], sizes['bss'], get_flash(sizes), get_sram(sizes), sizes['stack']]
+        else:
+            that = other.get(name, get_empty())
+            row = [get_flash(sizes), get_sram(sizes), get_flash(that), get_sram(that)]
+            row += [row[2] - row[0], row[3] - row[1]]
+        total = row if total is None else [a + b for a, b in zip(total, row)]
+        print(('%-16s' + ' %8d' * len(row)) % tuple([name] + row))
+    if total is not None:
+        if other is None:
+            total[-1] = max(sizes['stack'] for sizes in summary.values())
+        print(('%-16s' + ' %8d' * len(total)) % tuple(['TOTAL'] + total))
+
+
+def print_symbols(sections, count):
+    """
+    Prints the largest symbols.
+
+    @param sections Input sections.
+    @param count    Number of symbols to print.
+    """
+    symbols = []
+    for section in sections:
+        for name, size in get_symbols(section['section'], section['address'], section['size'], section['symbols']):
+            if name == section['section']:
+                name = '%s(%s)' % (os.path.basename(section['source'].replace('\\', '/')), name)
+            symbols.append((size, section['kind'], section['module'], name))
+    symbols.sort(key=lambda symbol: symbol[0], reverse=True)
+    symbols = symbols[:count]
+    names = demangle(symbol[3] for symbol in symbols)
+    print('')
+    print('%8s %-6s %-16s %s' % ('SIZE', 'KIND', 'MODULE', 'SYMBOL'))
+    for size, kind, module, name in symbols:
+        print('%8d %-6s %-16s %s' % (size, kind, module, names[name]))
+
+
+def print_stack(functions, count):
+    """
+    Prints functions with the largest stack usage.
+
+    @param functions Functions with stack usage.
+    @param count     Number of functions to print.
+    """
+    functions = sorted(functions, key=lambda function: function[2], reverse=True)[:count]
+    print('')
+    print('%8s %-10s %-16s %s' % ('STACK', 'TYPE', 'MODULE', 'FUNCTION'))
+    for module, function, usage, qualifier in functions:
+        print('%8d %-10s %-16s %s' % (usage, qualifier, module, function))
+
+
+def compare(summary, base, tolerance):
+    """
+    Compares footprint with the baseline.
+
+    @param summary   Footprint of the firmware.
+    @param base      Footprint of the baseline.
+    @param tolerance Bytes a module may grow by.
+    @return List of messages about modules which have grown.
+    """
+    messages = []
+    for name in sorted(set(summary) | set(base)):
+        sizes = summary.get(name, get_empty())
+        was_sizes = get_empty()
+        was_sizes.update(base.get(name, {}))
+        for region, size, was in (('FLASH', get_flash(sizes), get_flash(was_sizes)),
+                                  ('SRAM', get_sram(sizes), get_sram(was_sizes)),
+                                  ('STACK', sizes['stack'], was_sizes['stack'])):
+            if size > was + tolerance:
+                messages.append('%s: %s grew from %d to %d bytes by %d bytes' % (name, region, was, size, size - was))
+    return messages
+
+
+def main(argv):
+    parser = argparse.ArgumentParser(description='EOOS per-module FLASH and SRAM footprint')
+    parser.add_argument('map', help='linker map file of the firmware')
+    parser.add_argument('other', nargs='?', help='linker map file of the firmware to compare with')
+    parser.add_argument('--symbols', type=int, default=0, metavar='N', help='print N largest symbols')
+    parser.add_argument('--stack', metavar='DIR', help='directory with .su files of -fstack-usage option')
+    parser.add_argument('--save', metavar='FILE', help='save the footprint as a baseline')
+    parser.add_argument('--baseline', metavar='FILE', help='compare the footprint with a baseline')
+    parser.add_argument('--tolerance', type=int, default=0, metavar='BYTES', help='bytes a module may grow by')
+    args = parser.parse_args(argv[1:])
+    modules = get_modules(PROJECT)
+    sections = parse(args.map, modules)
+    functions = parse_stack(args.stack, modules) if args.stack else []
+    summary = summarize(sections, functions)
+    other = None
+    if args.other:
+        other = summarize(parse(args.other, modules))
+    print_summary(summary, other)
+    if args.symbols > 0:
+        print_symbols(sections, args.symbols)
+        if functions:
+            print_stack(functions, args.symbols)
+    if args.save:
+        baseline.save(args.save, summary)
+    res = 0
+    if args.baseline:
+        res = baseline.check(args.baseline, summary, compare, args.tolerance, 'FOOTPRINT', 'Footprint does not exceed baseline %s')
+    return res
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))